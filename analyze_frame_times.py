@@ -64,6 +64,11 @@ def analyze_frame_times(csv_file, skip_count=60):
     if 'profiler_ui_ms' in df.columns:
         print("\nProfiler Internal Stats:")
         print_stats("Profiler UI Update", df['profiler_ui_ms'])
+
+    # GPU time lags the CPU columns by the frames in flight and does not count towards the gap
+    if 'gpu_render_pass_ms' in df.columns:
+        print("\nGPU Stats:")
+        print_stats("Render Pass (GPU)", df['gpu_render_pass_ms'])
     
     # Calculate Unaccounted time
     # Frame Time - (Render + Begin + End + Poll + UI)
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <chrono>
+
+namespace aurora::bench {
+    using BenchmarkFunction = int (*)(int argc, char** argv);
+
+    struct Benchmark {
+        const char* name;
+        const char* description;
+        BenchmarkFunction run;
+    };
+
+    class Stopwatch {
+        public:
+            Stopwatch() : start{std::chrono::steady_clock::now()} {}
+
+            double elapsedMs() const {
+                return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            }
+
+        private:
+            std::chrono::steady_clock::time_point start;
+    };
+
+    int runBufferPoolBenchmark(int argc, char** argv);
+    int runInstanceLayoutBenchmark(int argc, char** argv);
+    int runProfilerBenchmark(int argc, char** argv);
+    int runQualityBenchmark(int argc, char** argv);
+    int runSpatialIndexBenchmark(int argc, char** argv);
+    int runStartupBenchmark(int argc, char** argv);
+    int runTerminalBenchmark(int argc, char** argv);
+    int runTransformBenchmark(int argc, char** argv);
+}
@@ -0,0 +1,94 @@
+#include "aurora_benchmarks.hpp"
+
+#include "aurora_engine/core/aurora_buffer_pool.hpp"
+#include "aurora_engine/utils/log.hpp"
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace aurora::bench {
+    namespace {
+        constexpr VkDeviceSize PAGE_SIZE = 16 * 1024 * 1024;
+        constexpr VkDeviceSize VERTEX_SIZE = 36;
+        constexpr VkDeviceSize ALIGNMENT = 256;
+
+        struct Allocation {
+            VkDeviceSize offset;
+            VkDeviceSize size;
+            uint32_t page;
+            uint32_t blockId;
+        };
+
+        // Mirrors AuroraBufferPool's page walk without touching the GPU
+        class PageSet {
+            public:
+                explicit PageSet(AuroraBufferPool::Strategy strategy) : strategy{strategy} {}
+
+                Allocation allocate(VkDeviceSize size) {
+                    Allocation allocation{0, size, 0, 0};
+                    for (uint32_t i = 0; i < pages.size(); ++i) {
+                        if (pages[i]->allocate(size, ALIGNMENT, allocation.offset, allocation.blockId)) {
+                            allocation.page = i;
+                            return allocation;
+                        }
+                    }
+
+                    pages.push_back(AuroraBufferPool::createOffsetAllocator(strategy, PAGE_SIZE));
+                    pages.back()->allocate(size, ALIGNMENT, allocation.offset, allocation.blockId);
+                    allocation.page = static_cast<uint32_t>(pages.size() - 1);
+                    return allocation;
+                }
+
+                void free(const Allocation& allocation) {
+                    pages[allocation.page]->free(allocation.offset, allocation.size, allocation.blockId);
+                }
+
+                size_t getPageCount() const { return pages.size(); }
+
+            private:
+                AuroraBufferPool::Strategy strategy;
+                std::vector<std::unique_ptr<AuroraOffsetAllocator>> pages;
+        };
+
+        void runStrategy(const char* name, AuroraBufferPool::Strategy strategy, size_t modelCount, size_t iterations) {
+            std::mt19937 rng{1234};
+            std::uniform_int_distribution<VkDeviceSize> glyphs{1, 256};
+            std::uniform_int_distribution<size_t> pick{0, modelCount - 1};
+
+            PageSet pageSet{strategy};
+            std::vector<Allocation> models;
+            models.reserve(modelCount);
+
+            Stopwatch setup;
+            for (size_t i = 0; i < modelCount; ++i) {
+                models.push_back(pageSet.allocate(glyphs(rng) * 4 * VERTEX_SIZE));
+            }
+            double setupMs = setup.elapsedMs();
+
+            // Text models are resized by freeing the old vertex range and allocating a new one
+            Stopwatch churn;
+            for (size_t i = 0; i < iterations; ++i) {
+                auto& model = models[pick(rng)];
+                pageSet.free(model);
+                model = pageSet.allocate(glyphs(rng) * 4 * VERTEX_SIZE);
+            }
+            double churnMs = churn.elapsedMs();
+
+            log::engine()->info("{:<9} setup {:8.2f} ms | churn {:8.2f} ms ({:7.1f} ns/resize) | pages {}",
+                name, setupMs, churnMs, churnMs * 1e6 / static_cast<double>(iterations), pageSet.getPageCount());
+        }
+    }
+
+    int runBufferPoolBenchmark(int argc, char** argv) {
+        size_t modelCount = argc > 1 ? std::stoul(argv[1]) : 20000;
+        size_t iterations = argc > 2 ? std::stoul(argv[2]) : 100000;
+
+        log::engine()->info("Buffer pool benchmark: {} models, {} resizes, {} MB pages", modelCount, iterations, PAGE_SIZE / (1024 * 1024));
+
+        runStrategy("first-fit", AuroraBufferPool::Strategy::FirstFit, modelCount, iterations);
+        runStrategy("tlsf", AuroraBufferPool::Strategy::Tlsf, modelCount, iterations);
+        return 0;
+    }
+}
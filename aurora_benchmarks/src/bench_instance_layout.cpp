@@ -0,0 +1,115 @@
+#include "aurora_benchmarks.hpp"
+
+#include "aurora_ui/graphics/aurora_model.hpp"
+#include "aurora_engine/utils/log.hpp"
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <cstring>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace aurora::bench {
+    namespace {
+        // The layouts the model pipeline used before the compact formats
+        struct WideInstance {
+            glm::mat4 modelMatrix;
+            glm::vec4 color;
+        };
+
+        struct WideVertex {
+            glm::vec3 position;
+            glm::vec4 color;
+            glm::vec2 texCoord;
+        };
+
+        struct Scene {
+            std::vector<glm::mat4> transforms;
+            std::vector<glm::vec4> colors;
+        };
+
+        Scene buildScene(size_t instanceCount) {
+            std::mt19937 rng{1234};
+            std::uniform_real_distribution<float> position{0.0f, 2000.0f};
+            std::uniform_real_distribution<float> scale{0.5f, 2.0f};
+            std::uniform_real_distribution<float> channel{0.0f, 1.0f};
+
+            Scene scene;
+            scene.transforms.reserve(instanceCount);
+            scene.colors.reserve(instanceCount);
+            for (size_t i = 0; i < instanceCount; ++i) {
+                glm::mat4 transform = glm::translate(glm::mat4(1.0f), glm::vec3(position(rng), position(rng), 0.5f));
+                transform = glm::scale(transform, glm::vec3(scale(rng), scale(rng), 1.0f));
+                scene.transforms.push_back(transform);
+                scene.colors.push_back({channel(rng), channel(rng), channel(rng), 1.0f});
+            }
+            return scene;
+        }
+
+        template <typename Instance>
+        Instance makeInstance(const glm::mat4& transform, const glm::vec4& color) {
+            if constexpr (std::is_same_v<Instance, WideInstance>) {
+                return {transform, color};
+            } else {
+                return Instance::fromWorldTransform(transform, color);
+            }
+        }
+
+        // Packs every instance into the CPU copy, then copies it to a buffer standing in for the
+        // mapped instance memory, like a frame that rewrites every slot
+        template <typename Instance>
+        void runLayout(const char* name, const Scene& scene, size_t frames) {
+            size_t instanceCount = scene.transforms.size();
+            std::vector<Instance> instances(instanceCount);
+            std::vector<unsigned char> mapped(instanceCount * sizeof(Instance));
+
+            double packMs = 0.0;
+            double copyMs = 0.0;
+            uint64_t checksum = 0;
+
+            for (size_t frame = 0; frame < frames; ++frame) {
+                Stopwatch pack;
+                for (size_t i = 0; i < instanceCount; ++i) {
+                    instances[i] = makeInstance<Instance>(scene.transforms[i], scene.colors[i]);
+                }
+                packMs += pack.elapsedMs();
+
+                Stopwatch copy;
+                std::memcpy(mapped.data(), instances.data(), mapped.size());
+                copyMs += copy.elapsedMs();
+
+                checksum += mapped[(frame * 4099) % mapped.size()];
+            }
+
+            double frameCount = static_cast<double>(frames);
+            double megabytes = static_cast<double>(mapped.size()) / (1024.0 * 1024.0);
+            double copyGbps = megabytes / 1024.0 / (copyMs / frameCount / 1000.0);
+
+            log::engine()->info("{:<8} {:3} B/instance | {:6.2f} MB/frame | pack {:6.3f} ms | copy {:6.3f} ms ({:5.1f} GB/s) | checksum {}",
+                name, sizeof(Instance), megabytes, packMs / frameCount, copyMs / frameCount, copyGbps, checksum);
+        }
+    }
+
+    int runInstanceLayoutBenchmark(int argc, char** argv) {
+        size_t instanceCount = argc > 1 ? std::stoul(argv[1]) : 100000;
+        size_t frames = argc > 2 ? std::stoul(argv[2]) : 200;
+
+        log::engine()->info("Instance layout benchmark: {} instances, {} frames", instanceCount, frames);
+
+        Scene scene = buildScene(instanceCount);
+        runLayout<WideInstance>("wide", scene, frames);
+        runLayout<AuroraModel::InstanceData>("compact", scene, frames);
+
+        // A 4x8 segment rounded rectangle, the largest model the UI builds
+        constexpr size_t ROUNDED_RECT_VERTICES = 4 * 9;
+        log::engine()->info("Vertices: {} B wide vs {} B compact, {} vs {} B per rounded rectangle",
+            sizeof(WideVertex), sizeof(AuroraModel::Vertex),
+            sizeof(WideVertex) * ROUNDED_RECT_VERTICES, sizeof(AuroraModel::Vertex) * ROUNDED_RECT_VERTICES);
+        return 0;
+    }
+}
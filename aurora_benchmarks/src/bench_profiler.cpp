@@ -0,0 +1,115 @@
+#include "aurora_benchmarks.hpp"
+
+#include "aurora_engine/profiling/aurora_profiler.hpp"
+#include "aurora_engine/utils/log.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace aurora::bench {
+    namespace {
+        // Mirrors the previous AuroraProfiler::addSample: global lock, string key, map lookup
+        class LockedProfiler {
+            public:
+                void addSample(const char* name, double timeMs) {
+                    std::lock_guard<std::mutex> lock(mutex);
+
+                    auto& stats = samples[std::string(name)];
+                    stats.current += timeMs;
+                    stats.sampleCount++;
+                    stats.minimum = std::min(stats.minimum, timeMs);
+                    stats.maximum = std::max(stats.maximum, timeMs);
+                }
+
+            private:
+                std::unordered_map<std::string, AuroraProfiler::StatisticalData> samples;
+                std::mutex mutex;
+        };
+
+        struct LockedBlock {
+            LockedProfiler& profiler;
+            const char* name;
+            std::chrono::high_resolution_clock::time_point startTime;
+
+            LockedBlock(LockedProfiler& profiler, const char* name)
+                : profiler{profiler}, name{name}, startTime{std::chrono::high_resolution_clock::now()} {}
+
+            ~LockedBlock() {
+                auto duration = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+                profiler.addSample(name, duration);
+            }
+        };
+
+        template <typename ZoneFunction>
+        double runThreads(size_t threadCount, size_t zonesPerThread, ZoneFunction zone) {
+            std::vector<std::thread> threads;
+            Stopwatch stopwatch;
+            for (size_t t = 0; t < threadCount; ++t) {
+                threads.emplace_back([&]() {
+                    for (size_t i = 0; i < zonesPerThread; ++i) {
+                        zone();
+                    }
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            return stopwatch.elapsedMs();
+        }
+
+        void report(const char* name, size_t threadCount, size_t zonesPerThread, double elapsedMs) {
+            log::engine()->info("{:<10} {} thread(s) | {:8.2f} ms | {:7.1f} ns/zone",
+                name, threadCount, elapsedMs, elapsedMs * 1e6 / static_cast<double>(zonesPerThread));
+        }
+    }
+
+    int runProfilerBenchmark(int argc, char** argv) {
+        size_t zonesPerThread = argc > 1 ? std::stoul(argv[1]) : 2000000;
+        size_t maxThreads = argc > 2 ? std::stoul(argv[2]) : 4;
+
+        log::engine()->info("Profiler benchmark: {} zones per thread, up to {} threads", zonesPerThread, maxThreads);
+
+        auto& profiler = AuroraProfiler::instance();
+        profiler.setEnabled(true);
+
+        for (size_t threadCount = 1; threadCount <= maxThreads; threadCount *= 2) {
+            LockedProfiler locked;
+            double lockedMs = runThreads(threadCount, zonesPerThread, [&]() {
+                LockedBlock block{locked, "Benchmark Zone"};
+            });
+            report("locked", threadCount, zonesPerThread, lockedMs);
+
+            // Aggregation runs on a separate thread, as newFrame() does on the main loop
+            std::atomic<bool> running{true};
+            uint64_t dropped = 0;
+            std::thread frameThread([&]() {
+                while (running.load(std::memory_order_relaxed)) {
+                    profiler.newFrame();
+                    dropped += profiler.getCounter("Profiler Dropped Events");
+                    std::this_thread::sleep_for(std::chrono::microseconds(20));
+                }
+            });
+
+            double lockFreeMs = runThreads(threadCount, zonesPerThread, []() {
+                AURORA_PROFILE("Benchmark Zone");
+            });
+
+            running = false;
+            frameThread.join();
+            profiler.newFrame();
+            dropped += profiler.getCounter("Profiler Dropped Events");
+            report("lock-free", threadCount, zonesPerThread, lockFreeMs);
+
+            if (dropped > 0) {
+                log::engine()->warn("{} events dropped because aggregation fell behind", dropped);
+            }
+        }
+
+        return 0;
+    }
+}
@@ -0,0 +1,146 @@
+#include "aurora_benchmarks.hpp"
+
+#include "aurora_ui/aurora_ui.hpp"
+#include "aurora_ui/components/aurora_card.hpp"
+#include "aurora_ui/components/aurora_circle.hpp"
+#include "aurora_ui/components/aurora_text.hpp"
+#include "aurora_ui/utils/aurora_theme_settings.hpp"
+#include "aurora_engine/profiling/aurora_gpu_profiler.hpp"
+#include "aurora_engine/profiling/aurora_profiler.hpp"
+#include "aurora_engine/utils/log.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace aurora::bench {
+    namespace {
+        const char* presentModeName(VkPresentModeKHR mode) {
+            switch (mode) {
+                case VK_PRESENT_MODE_IMMEDIATE_KHR: return "immediate";
+                case VK_PRESENT_MODE_MAILBOX_KHR: return "mailbox";
+                case VK_PRESENT_MODE_FIFO_KHR: return "fifo";
+                default: return "other";
+            }
+        }
+
+        std::vector<RenderQuality> buildSettings() {
+            std::vector<RenderQuality> settings;
+
+            // MSAA sweep, uncapped so the frame time reflects the rendering cost
+            for (VkSampleCountFlagBits samples : {VK_SAMPLE_COUNT_1_BIT, VK_SAMPLE_COUNT_2_BIT, VK_SAMPLE_COUNT_4_BIT, VK_SAMPLE_COUNT_8_BIT}) {
+                settings.push_back({samples, 1.0f, VK_PRESENT_MODE_IMMEDIATE_KHR});
+            }
+
+            for (float scale : {0.75f, 0.5f}) {
+                settings.push_back({VK_SAMPLE_COUNT_4_BIT, scale, VK_PRESENT_MODE_IMMEDIATE_KHR});
+            }
+
+            for (VkPresentModeKHR mode : {VK_PRESENT_MODE_FIFO_KHR, VK_PRESENT_MODE_MAILBOX_KHR}) {
+                settings.push_back({VK_SAMPLE_COUNT_4_BIT, 1.0f, mode});
+            }
+
+            return settings;
+        }
+
+        class QualityBenchmarkApp : public AuroraUI {
+            public:
+                QualityBenchmarkApp(size_t warmupFrames, size_t measuredFrames)
+                    : AuroraUI{"Aurora Quality Benchmark"}, settings{buildSettings()}, warmupFrames{warmupFrames}, measuredFrames{measuredFrames} {
+                    setRenderMode(RenderMode::Continuous);
+                    setFrameRateLimit(false);
+                    setRenderQuality(settings[0]);
+                }
+
+            protected:
+                void onSetup(AuroraComponentInfo& info) override {
+                    const auto& theme = AuroraThemeSettings::get();
+
+                    for (int row = 0; row < 6; ++row) {
+                        for (int column = 0; column < 8; ++column) {
+                            float x = 40.0f + static_cast<float>(column) * 230.0f;
+                            float y = 40.0f + static_cast<float>(row) * 170.0f;
+
+                            auto card = std::make_shared<AuroraCard>(info, glm::vec2{210.0f, 150.0f}, theme.BLUE);
+                            card->setPosition(x, y);
+                            card->addToRenderSystem();
+
+                            auto circle = std::make_shared<AuroraCircle>(info, 30.0f, theme.ORANGE);
+                            circle->setPosition(x + 50.0f, y + 75.0f);
+                            circle->addToRenderSystem();
+
+                            auto label = std::make_shared<AuroraText>(info, "Quality " + std::to_string(row * 8 + column), 20.0f);
+                            label->setPosition(x + 95.0f, y + 65.0f);
+                            label->addToRenderSystem();
+
+                            components.push_back(card);
+                            components.push_back(circle);
+                            components.push_back(label);
+                        }
+                    }
+
+                    log::engine()->info("Quality benchmark: {} settings, {} warm-up and {} measured frames each",
+                        settings.size(), warmupFrames, measuredFrames);
+                }
+
+                void onUpdate(float dt) override {
+                    // The first frame of a setting still runs with the previous swap chain
+                    if (frame++ <= warmupFrames) {
+                        return;
+                    }
+
+                    frameTimeMs += static_cast<double>(dt) * 1000.0;
+                    gpuTimeMs += AuroraProfiler::instance().getStats(AuroraGpuProfiler::RENDER_PASS_ZONE).current;
+
+                    if (frame <= warmupFrames + measuredFrames) {
+                        return;
+                    }
+
+                    report();
+
+                    if (++current >= settings.size()) {
+                        requestClose();
+                        return;
+                    }
+
+                    setRenderQuality(settings[current]);
+                    frame = 0;
+                    frameTimeMs = 0.0;
+                    gpuTimeMs = 0.0;
+                }
+
+            private:
+                void report() {
+                    const RenderQuality& quality = getRenderQuality();
+                    double frames = static_cast<double>(measuredFrames);
+                    VkExtent2D extent = getRenderer().getRenderExtent();
+
+                    log::engine()->info("{}x MSAA | {:3.0f}% scale ({}x{}) | {:<9} | {:7.3f} ms CPU | {:7.3f} ms GPU | {:7.1f} MB attachments",
+                        static_cast<int>(quality.msaaSamples), quality.renderScale * 100.0f, extent.width, extent.height,
+                        presentModeName(quality.presentMode), frameTimeMs / frames, gpuTimeMs / frames,
+                        static_cast<double>(getRenderer().getAttachmentMemorySize()) / (1024.0 * 1024.0));
+                }
+
+                std::vector<RenderQuality> settings;
+                std::vector<std::shared_ptr<AuroraComponentInterface>> components;
+
+                size_t warmupFrames;
+                size_t measuredFrames;
+                size_t current = 0;
+                size_t frame = 0;
+                double frameTimeMs = 0.0;
+                double gpuTimeMs = 0.0;
+        };
+    }
+
+    int runQualityBenchmark(int argc, char** argv) {
+        size_t measuredFrames = argc > 1 ? std::stoul(argv[1]) : 300;
+        size_t warmupFrames = argc > 2 ? std::stoul(argv[2]) : 60;
+
+        QualityBenchmarkApp app{warmupFrames, measuredFrames};
+        app.run();
+
+        log::engine()->info("Present modes the surface does not support fall back to fifo");
+        return 0;
+    }
+}
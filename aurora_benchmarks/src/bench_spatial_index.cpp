@@ -0,0 +1,261 @@
+#include "aurora_benchmarks.hpp"
+
+#include "aurora_ui/aurora_ui.hpp"
+#include "aurora_ui/components/aurora_rounded_rect.hpp"
+#include "aurora_ui/graphics/aurora_render_system_manager.hpp"
+#include "aurora_ui/utils/aurora_theme_settings.hpp"
+#include "aurora_engine/profiling/aurora_profiler.hpp"
+#include "aurora_engine/utils/log.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace aurora::bench {
+    namespace {
+        // Canvas sized so a full view covers about 1% of it
+        constexpr float CANVAS_SCALE = 10.0f;
+        constexpr size_t WARMUP_FRAMES = 10;
+
+        bool overlaps(const glm::vec4& a, const glm::vec4& b) {
+            return a.x <= b.z && b.x <= a.z && a.y <= b.w && b.y <= a.w;
+        }
+
+        bool containsPoint(const glm::vec4& bounds, glm::vec2 point) {
+            return point.x >= bounds.x && point.x <= bounds.z && point.y >= bounds.y && point.y <= bounds.w;
+        }
+
+        struct PhaseResult {
+            size_t frames = 0;
+            double frameMs = 0.0;
+            double transformMs = 0.0;
+            double cullMs = 0.0;
+            uint64_t visible = 0;
+        };
+
+        // Components scattered over a canvas ten views wide and tall, all children of one background.
+        // Scrolling moves the background, so every frame resolves and re-indexes the whole canvas;
+        // editing moves 1% of the components in place.
+        class SpatialIndexBenchmarkApp : public AuroraUI {
+            public:
+                SpatialIndexBenchmarkApp(size_t componentCount, size_t frames, size_t pickCount)
+                    : AuroraUI{"Aurora Spatial Index Benchmark"}, componentCount{componentCount}, frames{frames}, pickCount{pickCount} {
+                    setRenderMode(RenderMode::Continuous);
+                    setFrameRateLimit(false);
+                }
+
+                bool hasFailed() const { return failed; }
+
+            protected:
+                void onSetup(AuroraComponentInfo& info) override {
+                    const auto& theme = AuroraThemeSettings::get();
+                    manager = &info.renderSystemManager;
+
+                    viewSize = {static_cast<float>(getRenderer().getWidth()), static_cast<float>(getRenderer().getHeight())};
+                    canvasSize = viewSize * CANVAS_SCALE;
+
+                    std::uniform_real_distribution<float> positionX{0.0f, canvasSize.x};
+                    std::uniform_real_distribution<float> positionY{0.0f, canvasSize.y};
+                    std::uniform_real_distribution<float> extent{20.0f, 60.0f};
+
+                    Stopwatch setupTimer;
+                    canvas = std::make_shared<AuroraRoundedRectangle>(info, canvasSize, 0.0f);
+                    canvas->setColor(theme.BACKGROUND);
+
+                    positions.resize(componentCount);
+                    sizes.resize(componentCount);
+                    components.reserve(componentCount);
+                    for (size_t i = 0; i < componentCount; ++i) {
+                        positions[i] = {positionX(rng), positionY(rng)};
+                        sizes[i] = {extent(rng), extent(rng)};
+
+                        auto component = std::make_shared<AuroraRoundedRectangle>(info, sizes[i], 4.0f);
+                        component->setPosition(positions[i]);
+                        component->setColor(i % 2 ? theme.BLUE : theme.ORANGE);
+                        canvas->addChild(component);
+                        components.push_back(std::move(component));
+                    }
+                    canvas->addToRenderSystem();
+
+                    log::engine()->info("Spatial index benchmark: {} components on a {}x{} canvas, {}x{} view, {} frames per phase, setup {:.1f} ms",
+                        componentCount, canvasSize.x, canvasSize.y, viewSize.x, viewSize.y, frames, setupTimer.elapsedMs());
+                }
+
+                void onUpdate(float dt) override {
+                    // Stats and counters read here describe the frame that just ended
+                    if (measuring) {
+                        auto& profiler = AuroraProfiler::instance();
+                        measuring->frames++;
+                        measuring->frameMs += static_cast<double>(dt) * 1000.0;
+                        measuring->transformMs += profiler.getStats("Update Transforms").current;
+                        measuring->cullMs += profiler.getStats("Cull Components").current;
+                        measuring->visible += profiler.getCounter("Visible Components");
+                    }
+
+                    if (frame < WARMUP_FRAMES + frames) {
+                        scroll();
+                        measuring = frame >= WARMUP_FRAMES ? &scrollResult : nullptr;
+                    } else if (frame < WARMUP_FRAMES + 2 * frames) {
+                        edit();
+                        measuring = &editResult;
+                    } else {
+                        measuring = nullptr;
+                        report("scroll", scrollResult);
+                        report("edit", editResult);
+                        verifyQueries();
+                        verifyPicks();
+                        requestClose();
+                    }
+                    ++frame;
+                }
+
+            private:
+                // Diagonally across the canvas, wrapping at the edges
+                void scroll() {
+                    float x = static_cast<float>(frame * 37 % static_cast<size_t>(canvasSize.x - viewSize.x));
+                    float y = static_cast<float>(frame * 23 % static_cast<size_t>(canvasSize.y - viewSize.y));
+                    canvasOffset = {-x, -y};
+                    canvas->setPosition(canvasOffset);
+                }
+
+                void edit() {
+                    std::uniform_int_distribution<size_t> pick{0, componentCount - 1};
+                    std::uniform_real_distribution<float> step{-8.0f, 8.0f};
+
+                    size_t moves = std::max<size_t>(1, componentCount / 100);
+                    for (size_t m = 0; m < moves; ++m) {
+                        size_t i = pick(rng);
+                        positions[i] += glm::vec2{step(rng), step(rng)};
+                        components[i]->setPosition(positions[i]);
+                    }
+                }
+
+                // World bounds as the scene store derives them: canvas offset, then local position and size
+                glm::vec4 getWorldBounds(size_t i) const {
+                    glm::vec2 min = positions[i] + canvasOffset;
+                    return {min, min + sizes[i]};
+                }
+
+                void report(const char* name, const PhaseResult& result) {
+                    double count = static_cast<double>(std::max<size_t>(result.frames, 1));
+                    log::engine()->info("{:<6} | {:8.3f} ms frame | {:8.3f} ms transforms | {:8.3f} ms cull | {:8.0f} visible",
+                        name, result.frameMs / count, result.transformMs / count, result.cullMs / count,
+                        static_cast<double>(result.visible) / count);
+                }
+
+                void verifyQueries() {
+                    std::uniform_real_distribution<float> positionX{0.0f, canvasSize.x - viewSize.x};
+                    std::uniform_real_distribution<float> positionY{0.0f, canvasSize.y - viewSize.y};
+
+                    std::vector<AuroraComponentInterface*> results;
+                    for (size_t q = 0; q < 10; ++q) {
+                        glm::vec2 min = glm::vec2{positionX(rng), positionY(rng)} + canvasOffset;
+                        glm::vec4 rect{min, min + viewSize};
+
+                        size_t linear = overlaps({canvasOffset, canvasOffset + canvasSize}, rect) ? 1 : 0;
+                        for (size_t i = 0; i < componentCount; ++i) {
+                            if (overlaps(getWorldBounds(i), rect)) ++linear;
+                        }
+
+                        results.clear();
+                        manager->queryComponents(rect, results);
+                        if (results.size() != linear) {
+                            log::engine()->error("Query {} returned {} components, a linear scan finds {}", q, results.size(), linear);
+                            failed = true;
+                        }
+                    }
+                }
+
+                void verifyPicks() {
+                    std::uniform_real_distribution<float> positionX{0.0f, viewSize.x};
+                    std::uniform_real_distribution<float> positionY{0.0f, viewSize.y};
+                    std::vector<glm::vec2> points(pickCount);
+                    for (auto& point : points) {
+                        point = {positionX(rng), positionY(rng)};
+                    }
+
+                    // Resolved once, the linear pass should only measure the scan
+                    std::vector<float> depths(componentCount);
+                    for (size_t i = 0; i < componentCount; ++i) {
+                        depths[i] = components[i]->getWorldTransform()[3][2];
+                    }
+                    float canvasDepth = canvas->getWorldTransform()[3][2];
+                    glm::vec4 canvasBounds{canvasOffset, canvasOffset + canvasSize};
+
+                    std::vector<AuroraComponentInterface*> linearPicks(pickCount, nullptr);
+                    Stopwatch linearTimer;
+                    for (size_t p = 0; p < pickCount; ++p) {
+                        AuroraComponentInterface* picked = nullptr;
+                        float pickedDepth = 0.0f;
+                        if (containsPoint(canvasBounds, points[p])) {
+                            picked = canvas.get();
+                            pickedDepth = canvasDepth;
+                        }
+                        for (size_t i = 0; i < componentCount; ++i) {
+                            if (containsPoint(getWorldBounds(i), points[p]) && (!picked || depths[i] < pickedDepth)) {
+                                picked = components[i].get();
+                                pickedDepth = depths[i];
+                            }
+                        }
+                        linearPicks[p] = picked;
+                    }
+                    double linearMs = linearTimer.elapsedMs();
+
+                    std::vector<AuroraComponentInterface*> indexPicks(pickCount, nullptr);
+                    Stopwatch indexTimer;
+                    for (size_t p = 0; p < pickCount; ++p) {
+                        indexPicks[p] = manager->pickComponent(points[p]);
+                    }
+                    double indexMs = indexTimer.elapsedMs();
+
+                    size_t hits = 0;
+                    size_t mismatches = 0;
+                    for (size_t p = 0; p < pickCount; ++p) {
+                        if (indexPicks[p] != canvas.get()) ++hits;
+                        if (indexPicks[p] != linearPicks[p]) ++mismatches;
+                    }
+
+                    log::engine()->info("pick   | {:8} points | {:10.3f} us linear | {:8.3f} us index | {} hit a component",
+                        pickCount, linearMs * 1000.0 / static_cast<double>(pickCount), indexMs * 1000.0 / static_cast<double>(pickCount), hits);
+
+                    if (mismatches > 0) {
+                        log::engine()->error("{} of {} picks differ from a linear scan", mismatches, pickCount);
+                        failed = true;
+                    }
+                }
+
+                size_t componentCount;
+                size_t frames;
+                size_t pickCount;
+
+                AuroraRenderSystemManager* manager = nullptr;
+                std::shared_ptr<AuroraRoundedRectangle> canvas;
+                std::vector<std::shared_ptr<AuroraRoundedRectangle>> components;
+                std::vector<glm::vec2> positions;
+                std::vector<glm::vec2> sizes;
+
+                glm::vec2 viewSize{0.0f};
+                glm::vec2 canvasSize{0.0f};
+                glm::vec2 canvasOffset{0.0f};
+
+                std::mt19937 rng{42};
+                size_t frame = 0;
+                PhaseResult scrollResult;
+                PhaseResult editResult;
+                PhaseResult* measuring = nullptr;
+                bool failed = false;
+        };
+    }
+
+    int runSpatialIndexBenchmark(int argc, char** argv) {
+        size_t componentCount = argc > 1 ? std::stoul(argv[1]) : 1000000;
+        size_t frames = argc > 2 ? std::stoul(argv[2]) : 200;
+        size_t pickCount = argc > 3 ? std::stoul(argv[3]) : 200;
+
+        SpatialIndexBenchmarkApp app{componentCount, frames, pickCount};
+        app.run();
+        return app.hasFailed() ? 1 : 0;
+    }
+}
@@ -0,0 +1,93 @@
+#include "aurora_benchmarks.hpp"
+
+#include "aurora_ui/aurora_ui.hpp"
+#include "aurora_ui/components/aurora_card.hpp"
+#include "aurora_ui/components/aurora_circle.hpp"
+#include "aurora_ui/components/aurora_text.hpp"
+#include "aurora_ui/components/aurora_triangle.hpp"
+#include "aurora_ui/utils/aurora_theme_settings.hpp"
+#include "aurora_engine/core/aurora_pipeline_cache.hpp"
+#include "aurora_engine/profiling/aurora_profiler.hpp"
+#include "aurora_engine/utils/log.hpp"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace aurora::bench {
+    namespace {
+        // Builds a scene touching the shape, glyph and model pipelines and closes after its first frame
+        class StartupBenchmarkApp : public AuroraUI {
+            public:
+                explicit StartupBenchmarkApp(bool warmUp) : AuroraUI{"Aurora Startup Benchmark"} {
+                    setRenderMode(RenderMode::Continuous);
+                    setFrameRateLimit(false);
+                    setPipelineWarmUp(warmUp);
+                }
+
+            protected:
+                void onSetup(AuroraComponentInfo& info) override {
+                    const auto& theme = AuroraThemeSettings::get();
+
+                    auto card = std::make_shared<AuroraCard>(info, glm::vec2{300.0f, 200.0f}, theme.BLUE);
+                    card->setPosition(100.0f, 100.0f);
+                    card->addToRenderSystem();
+
+                    auto circle = std::make_shared<AuroraCircle>(info, 40.0f, theme.ORANGE);
+                    circle->setPosition(500.0f, 200.0f);
+                    circle->addToRenderSystem();
+
+                    auto triangle = std::make_shared<AuroraTriangle>(info);
+                    triangle->setPosition(700.0f, 200.0f);
+                    triangle->setScale(100.0f, 100.0f);
+                    triangle->addToRenderSystem();
+
+                    auto label = std::make_shared<AuroraText>(info, "Startup", 24.0f);
+                    label->setPosition(140.0f, 180.0f);
+                    label->addToRenderSystem();
+
+                    components = {card, circle, triangle, label};
+                }
+
+                void onUpdate(float) override {
+                    // Called before the second frame, once the first has been recorded
+                    if (frame++ == 1) {
+                        requestClose();
+                    }
+                }
+
+            private:
+                std::vector<std::shared_ptr<AuroraComponentInterface>> components;
+                size_t frame = 0;
+        };
+
+        void runCase(const char* name, bool coldCache, bool warmUp) {
+            if (coldCache) {
+                std::remove(AuroraPipelineCache::DEFAULT_PATH);
+            }
+
+            {
+                StartupBenchmarkApp app{warmUp};
+                app.run();
+            }
+
+            auto& profiler = AuroraProfiler::instance();
+            log::engine()->info("{:<22} | {:8.1f} ms to first frame | engine init {:7.1f} ms | warm-up {:7.1f} ms | setup {:6.1f} ms | first frame {:7.1f} ms",
+                name, profiler.getStartupTime("Time To First Frame"), profiler.getStartupTime("Engine Init"),
+                warmUp ? profiler.getStartupTime("Pipeline Warm-Up") : 0.0, profiler.getStartupTime("Setup"),
+                profiler.getStartupTime("First Frame"));
+        }
+    }
+
+    int runStartupBenchmark(int, char**) {
+        log::engine()->info("Startup benchmark: time to first frame with a cold or warm pipeline cache, with and without warm-up");
+
+        // The cold cases go first, the cache they leave behind warms the others
+        runCase("cold cache", true, false);
+        runCase("cold cache + warm-up", true, true);
+        runCase("warm cache", false, false);
+        runCase("warm cache + warm-up", false, true);
+        return 0;
+    }
+}
@@ -0,0 +1,130 @@
+#include "aurora_benchmarks.hpp"
+
+#include "aurora_ui/utils/aurora_scrollback.hpp"
+#include "aurora_engine/utils/log.hpp"
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace aurora::bench {
+    namespace {
+        std::vector<std::string> buildLogLines(size_t count) {
+            static const char* LEVELS[] = {"info ", "debug", "warn ", "error"};
+            static const char* WORDS[] = {"frame", "recorded", "draws", "upload", "pipeline", "descriptor", "glyph", "instances", "swapchain", "retired"};
+
+            std::mt19937 rng{42};
+            std::vector<std::string> lines;
+            lines.reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                std::string line = "[12:00:" + std::to_string(10 + i % 50) + "." + std::to_string(100 + i % 900) + "] [engine] [" + LEVELS[rng() % 4] + "]";
+
+                // Mostly single lines with the odd one long enough to wrap
+                size_t words = 4 + rng() % (i % 8 == 0 ? 40 : 12);
+                for (size_t w = 0; w < words; ++w) {
+                    line += ' ';
+                    line += WORDS[rng() % 10];
+                    if (w % 3 == 0) line += std::to_string(rng() % 10000);
+                }
+                lines.push_back(std::move(line));
+            }
+            return lines;
+        }
+
+        // The previous terminal storage: lines wrapped through a stringstream into fresh strings,
+        // old ones erased from the front of a vector
+        class VectorScrollback {
+            public:
+                VectorScrollback(size_t capacity, size_t maxLineLength) : capacity{capacity}, maxLineLength{maxLineLength} {}
+
+                size_t append(const std::string& text) {
+                    std::istringstream words(text);
+                    std::string word;
+                    std::string currentLine;
+                    size_t appended = 0;
+
+                    while (words >> word) {
+                        if (!currentLine.empty() && (currentLine.length() + 1 + word.length()) > maxLineLength) {
+                            lines.push_back(currentLine);
+                            ++appended;
+                            currentLine = word;
+                        } else {
+                            if (!currentLine.empty()) currentLine += " ";
+                            currentLine += word;
+                        }
+                    }
+                    lines.push_back(currentLine);
+                    ++appended;
+
+                    while (lines.size() > capacity) {
+                        lines.erase(lines.begin());
+                    }
+                    return appended;
+                }
+
+                size_t getMemory() const {
+                    size_t bytes = lines.capacity() * sizeof(std::string);
+                    for (const auto& line : lines) bytes += line.capacity();
+                    return bytes;
+                }
+
+            private:
+                size_t capacity;
+                size_t maxLineLength;
+                std::vector<std::string> lines;
+        };
+
+        size_t getMemory(const AuroraScrollback& scrollback) {
+            size_t bytes = scrollback.getCapacity() * sizeof(std::string);
+            for (uint64_t slot = 0; slot < scrollback.getCapacity(); ++slot) {
+                bytes += scrollback.getLine(slot).capacity();
+            }
+            return bytes;
+        }
+
+        template <typename Scrollback>
+        void runCase(const char* name, Scrollback& scrollback, const std::vector<std::string>& source, size_t appendCount) {
+            auto memory = [&]() {
+                if constexpr (std::is_same_v<Scrollback, AuroraScrollback>) return getMemory(scrollback);
+                else return scrollback.getMemory();
+            };
+
+            // Warm up to a full scrollback so both report steady-state memory
+            for (size_t i = 0; i < 20000; ++i) {
+                scrollback.append(source[i % source.size()]);
+            }
+            size_t memoryBefore = memory();
+
+            size_t wrapped = 0;
+            Stopwatch timer;
+            for (size_t i = 0; i < appendCount; ++i) {
+                wrapped += scrollback.append(source[i % source.size()]);
+            }
+            double ms = timer.elapsedMs();
+
+            log::engine()->info("{:<6} {:8} appends -> {:8} lines | {:8.1f} ms | {:10.0f} appends/s | {:7.1f} ns/append | memory {:6} KB -> {:6} KB",
+                name, appendCount, wrapped, ms, static_cast<double>(appendCount) / (ms / 1000.0),
+                ms * 1e6 / static_cast<double>(appendCount), memoryBefore / 1024, memory() / 1024);
+        }
+    }
+
+    int runTerminalBenchmark(int argc, char** argv) {
+        size_t appendCount = argc > 1 ? std::stoul(argv[1]) : 1000000;
+        size_t capacity = argc > 2 ? std::stoul(argv[2]) : 10000;
+        size_t lineLength = argc > 3 ? std::stoul(argv[3]) : 120;
+
+        log::engine()->info("Terminal benchmark: {} appends, {} line scrollback, {} chars per line", appendCount, capacity, lineLength);
+
+        std::vector<std::string> source = buildLogLines(4096);
+
+        VectorScrollback vector{capacity, lineLength};
+        runCase("vector", vector, source, std::min<size_t>(appendCount, 100000));
+
+        AuroraScrollback ring{capacity, lineLength};
+        runCase("ring", ring, source, appendCount);
+        return 0;
+    }
+}
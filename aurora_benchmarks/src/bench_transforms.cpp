@@ -0,0 +1,185 @@
+#include "aurora_benchmarks.hpp"
+
+#include "aurora_ui/graphics/aurora_scene_store.hpp"
+#include "aurora_engine/profiling/aurora_profiler.hpp"
+#include "aurora_engine/utils/log.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace aurora::bench {
+    namespace {
+        // The pointer tree components used to keep, updated eagerly by every setter
+        struct Node {
+            TransformComponent transform{};
+            glm::mat4 worldTransform{1.0f};
+            Node* parent = nullptr;
+            std::vector<Node*> children;
+            AuroraSceneStore::NodeId storeNode = AuroraSceneStore::INVALID_NODE;
+        };
+
+        class Scene {
+            public:
+                // Every root is a chain of `depth` nested groups whose innermost group holds `leaves` children
+                Scene(size_t rootCount, size_t depth, size_t leaves) {
+                    for (size_t r = 0; r < rootCount; ++r) {
+                        Node* group = createNode(nullptr);
+                        roots.push_back(group);
+
+                        for (size_t d = 1; d < depth; ++d) {
+                            group = createNode(group);
+                            setLocal(group, {4.0f, 4.0f, 0.0f});
+                        }
+                        for (size_t l = 0; l < leaves; ++l) {
+                            Node* leaf = createNode(group);
+                            setLocal(leaf, {static_cast<float>(l % 20) * 10.0f, static_cast<float>(l / 20) * 20.0f, 0.0f});
+                        }
+                    }
+
+                    for (Node* root : roots) {
+                        updateEager(root);
+                    }
+                    store.updateTransforms();
+                }
+
+                void moveEager(Node* node, glm::vec2 position) {
+                    node->transform.translation.x = position.x;
+                    node->transform.translation.y = position.y;
+                    updateEager(node);
+                }
+
+                void moveStore(Node* node, glm::vec2 position) {
+                    TransformComponent transform = store.getLocalTransform(node->storeNode);
+                    transform.translation.x = position.x;
+                    transform.translation.y = position.y;
+                    store.setLocalTransform(node->storeNode, transform);
+                }
+
+                const std::vector<Node*>& getRoots() const { return roots; }
+                const std::vector<std::unique_ptr<Node>>& getNodes() const { return nodes; }
+                AuroraSceneStore& getStore() { return store; }
+
+                size_t updates = 0;
+
+            private:
+                Node* createNode(Node* parent) {
+                    nodes.push_back(std::make_unique<Node>());
+                    Node* node = nodes.back().get();
+                    node->parent = parent;
+                    node->storeNode = store.createNode(nullptr);
+                    if (parent) {
+                        parent->children.push_back(node);
+                        store.setParent(node->storeNode, parent->storeNode);
+                    }
+                    return node;
+                }
+
+                void setLocal(Node* node, glm::vec3 translation) {
+                    node->transform.translation = translation;
+                    store.setLocalTransform(node->storeNode, node->transform);
+                }
+
+                void computeWorld(Node* node) {
+                    glm::mat4 localTransform = node->transform.mat4();
+                    if (node->parent) {
+                        float ourZDepth = localTransform[3][2];
+                        node->worldTransform = node->parent->worldTransform * localTransform;
+                        node->worldTransform[3][2] = ourZDepth;
+                    } else {
+                        node->worldTransform = localTransform;
+                    }
+                    ++updates;
+                }
+
+                // The previous behaviour: every setter recomputes the whole subtree right away
+                void updateEager(Node* node) {
+                    computeWorld(node);
+                    for (Node* child : node->children) {
+                        updateEager(child);
+                    }
+                }
+
+                std::vector<std::unique_ptr<Node>> nodes;
+                std::vector<Node*> roots;
+                AuroraSceneStore store;
+        };
+
+        // Moves `movedRoots` roots `movesPerFrame` times per frame, like a drag handled in onUpdate
+        void runCase(const char* name, size_t rootCount, size_t depth, size_t leaves, size_t movedRoots, size_t movesPerFrame, size_t frames) {
+            Scene eager{rootCount, depth, leaves};
+            Scene flat{rootCount, depth, leaves};
+            eager.updates = 0;
+
+            auto positionFor = [](size_t frame, size_t move, size_t root) {
+                float t = static_cast<float>(frame * 7 + move * 3 + root);
+                return glm::vec2{100.0f + std::sin(t) * 50.0f, 100.0f + std::cos(t) * 50.0f};
+            };
+
+            movedRoots = std::min(movedRoots, rootCount);
+
+            Stopwatch eagerTimer;
+            for (size_t frame = 0; frame < frames; ++frame) {
+                for (size_t move = 0; move < movesPerFrame; ++move) {
+                    for (size_t r = 0; r < movedRoots; ++r) {
+                        eager.moveEager(eager.getRoots()[r], positionFor(frame, move, r));
+                    }
+                }
+            }
+            double eagerMs = eagerTimer.elapsedMs();
+
+            AuroraSceneStore& store = flat.getStore();
+            // Counters accumulate until newFrame(), which publishes them; this one starts the count from zero
+            auto& profiler = AuroraProfiler::instance();
+            profiler.newFrame();
+
+            Stopwatch storeTimer;
+            for (size_t frame = 0; frame < frames; ++frame) {
+                for (size_t move = 0; move < movesPerFrame; ++move) {
+                    for (size_t r = 0; r < movedRoots; ++r) {
+                        flat.moveStore(flat.getRoots()[r], positionFor(frame, move, r));
+                    }
+                }
+                store.updateTransforms();
+            }
+            double storeMs = storeTimer.elapsedMs();
+            profiler.newFrame();
+            uint64_t storeUpdates = profiler.getCounter("Transforms Updated");
+
+            // Both strategies must end up with the same world transforms
+            float maxError = 0.0f;
+            for (size_t i = 0; i < eager.getNodes().size(); ++i) {
+                const glm::mat4& a = eager.getNodes()[i]->worldTransform;
+                const glm::mat4& b = store.getWorldTransform(flat.getNodes()[i]->storeNode);
+                for (int column = 0; column < 4; ++column) {
+                    for (int row = 0; row < 4; ++row) {
+                        maxError = std::max(maxError, std::abs(a[column][row] - b[column][row]));
+                    }
+                }
+            }
+
+            double frameCount = static_cast<double>(frames);
+            log::engine()->info("{:<8} {:6} nodes | eager {:8.3f} ms/frame {:8.0f} updates | store {:8.3f} ms/frame {:8.0f} updates | {:5.1f}x | max error {}",
+                name, eager.getNodes().size(),
+                eagerMs / frameCount, static_cast<double>(eager.updates) / frameCount,
+                storeMs / frameCount, static_cast<double>(storeUpdates) / frameCount,
+                eagerMs / std::max(storeMs, 1e-6), maxError);
+        }
+    }
+
+    int runTransformBenchmark(int argc, char** argv) {
+        size_t frames = argc > 1 ? std::stoul(argv[1]) : 200;
+        size_t movesPerFrame = argc > 2 ? std::stoul(argv[2]) : 4;
+
+        log::engine()->info("Transform benchmark: {} frames, {} moves per frame", frames, movesPerFrame);
+
+        // A panel with 200 text children, dragged around
+        runCase("panel", 1, 1, 200, 1, movesPerFrame, frames);
+        // Dashboards of nested groups, a few of them animating
+        runCase("nested", 50, 8, 200, 5, movesPerFrame, frames);
+        runCase("deep", 20, 64, 50, 20, movesPerFrame, frames);
+        return 0;
+    }
+}
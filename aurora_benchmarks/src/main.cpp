@@ -0,0 +1,44 @@
+#include "aurora_benchmarks.hpp"
+
+#include "aurora_engine/utils/log.hpp"
+
+#include <cstring>
+
+namespace {
+    const aurora::bench::Benchmark BENCHMARKS[] = {
+        {"buffer_pool", "First-fit vs TLSF page allocator under model resize churn", aurora::bench::runBufferPoolBenchmark},
+        {"instance_layout", "Packing and upload bandwidth of the 80 B vs 32 B instance layout", aurora::bench::runInstanceLayoutBenchmark},
+        {"profiler", "Per-zone cost of the locked vs lock-free profiler", aurora::bench::runProfilerBenchmark},
+        {"quality", "Frame time and attachment memory per MSAA, render scale and present mode", aurora::bench::runQualityBenchmark},
+        {"spatial_index", "Transform, cull and pick cost on a scrolling canvas, checked against linear scans", aurora::bench::runSpatialIndexBenchmark},
+        {"startup", "Time to first frame with a cold or warm pipeline cache and pipeline warm-up", aurora::bench::runStartupBenchmark},
+        {"terminal", "Terminal scrollback append throughput and memory, vector vs ring buffer", aurora::bench::runTerminalBenchmark},
+        {"transforms", "Eager pointer-tree vs flat scene store transform updates", aurora::bench::runTransformBenchmark},
+    };
+
+    void printUsage(const char* program) {
+        aurora::log::engine()->info("Usage: {} <benchmark> [args...]", program);
+        for (const auto& benchmark : BENCHMARKS) {
+            aurora::log::engine()->info("  {:<16} {}", benchmark.name, benchmark.description);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    aurora::log::init();
+
+    if (argc < 2) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    for (const auto& benchmark : BENCHMARKS) {
+        if (std::strcmp(argv[1], benchmark.name) == 0) {
+            return benchmark.run(argc - 1, argv + 1);
+        }
+    }
+
+    aurora::log::engine()->error("Unknown benchmark: {}", argv[1]);
+    printUsage(argv[0]);
+    return 1;
+}
@@ -2,10 +2,13 @@
 
 #include "aurora_debug_session.hpp"
 
+#include <condition_variable>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace aurora::debug {
@@ -35,10 +38,20 @@ namespace aurora::debug {
             void onDisconnect(std::function<void(const std::string& address)> handler);
             void onMessage(std::function<void(AuroraDebugSession&, const DebugMessage&)> handler);
 
+            // Called from a watcher thread when a socket becomes readable, so a render loop
+            // blocked waiting for window events can be woken. Re-arms on the next poll().
+            void onWake(std::function<void()> handler);
+
         private:
             void acceptConnections();
             void pollSessions();
 
+            void startWatcher();
+            void stopWatcher();
+            void rearmWatcher();
+            void interruptWatcher();
+            void watchSockets();
+
             uint16_t port;
             int serverFd{-1};
             bool running{false};
@@ -48,6 +61,15 @@ namespace aurora::debug {
             std::function<void(AuroraDebugSession&)> connectHandler;
             std::function<void(const std::string&)> disconnectHandler;
             std::function<void(AuroraDebugSession&, const DebugMessage&)> messageHandler;
+            std::function<void()> wakeHandler;
+
+            std::thread watcher;
+            std::mutex watchMutex;
+            std::condition_variable watchCondition;
+            std::vector<int> watchedFds;
+            bool wakePending{false};
+            bool watcherStopping{false};
+            int wakePipe[2]{-1, -1};
     };
 
 }
\ No newline at end of file
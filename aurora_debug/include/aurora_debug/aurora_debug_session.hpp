@@ -23,6 +23,7 @@ namespace aurora::debug {
             bool poll(const std::function<void(const DebugMessage&)>& onMessage);
 
             bool isConnected() const;
+            int getFd() const { return fd; }
             const std::string& getAddress() const;
 
         private:
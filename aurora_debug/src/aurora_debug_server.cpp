@@ -5,7 +5,9 @@
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <fcntl.h>
+#include <poll.h>
 #include <unistd.h>
+#include <errno.h>
 
 namespace aurora::debug {
 
@@ -45,11 +47,16 @@ namespace aurora::debug {
         listen(serverFd, 8);
         running = true;
         aurora::log::debug()->info("Server listening on port {}", port);
+
+        if (wakeHandler) {
+            startWatcher();
+        }
     }
 
     void AuroraDebugServer::stop() {
         if (!running) return;
         running = false;
+        stopWatcher();
         sessions.clear();
         if (serverFd >= 0) {
             close(serverFd);
@@ -62,6 +69,7 @@ namespace aurora::debug {
         if (!running) return;
         acceptConnections();
         pollSessions();
+        rearmWatcher();
     }
 
     void AuroraDebugServer::acceptConnections() {
@@ -111,4 +119,107 @@ namespace aurora::debug {
         messageHandler = std::move(handler);
     }
 
+    void AuroraDebugServer::onWake(std::function<void()> handler) {
+        wakeHandler = std::move(handler);
+    }
+
+    void AuroraDebugServer::startWatcher() {
+        if (pipe(wakePipe) < 0) {
+            aurora::log::debug()->error("Failed to create watcher pipe, sockets will only be read on poll()");
+            return;
+        }
+        for (int fd : wakePipe) {
+            int flags = fcntl(fd, F_GETFL, 0);
+            fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+        }
+
+        watchedFds = {serverFd};
+        wakePending = false;
+        watcherStopping = false;
+        watcher = std::thread(&AuroraDebugServer::watchSockets, this);
+    }
+
+    void AuroraDebugServer::stopWatcher() {
+        if (!watcher.joinable()) return;
+
+        {
+            std::lock_guard<std::mutex> lock(watchMutex);
+            watcherStopping = true;
+        }
+        watchCondition.notify_one();
+
+        interruptWatcher();
+        watcher.join();
+
+        close(wakePipe[0]);
+        close(wakePipe[1]);
+        wakePipe[0] = wakePipe[1] = -1;
+    }
+
+    void AuroraDebugServer::rearmWatcher() {
+        if (!watcher.joinable()) return;
+
+        std::vector<int> fds{serverFd};
+        for (const auto& session : sessions) {
+            fds.push_back(session->getFd());
+        }
+
+        bool interrupt = false;
+        {
+            std::lock_guard<std::mutex> lock(watchMutex);
+            // A watcher blocked in ::poll() on a stale descriptor set has to be kicked out of it
+            interrupt = !wakePending && fds != watchedFds;
+            watchedFds = std::move(fds);
+            wakePending = false;
+        }
+        watchCondition.notify_one();
+
+        if (interrupt) {
+            interruptWatcher();
+        }
+    }
+
+    void AuroraDebugServer::interruptWatcher() {
+        char byte = 0;
+        if (write(wakePipe[1], &byte, 1) < 0 && errno != EAGAIN) {
+            aurora::log::debug()->warn("Failed to signal socket watcher");
+        }
+    }
+
+    void AuroraDebugServer::watchSockets() {
+        std::vector<pollfd> fds;
+
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(watchMutex);
+                watchCondition.wait(lock, [this] { return watcherStopping || !wakePending; });
+                if (watcherStopping) return;
+
+                fds.clear();
+                fds.push_back({wakePipe[0], POLLIN, 0});
+                for (int fd : watchedFds) {
+                    fds.push_back({fd, POLLIN, 0});
+                }
+            }
+
+            if (::poll(fds.data(), fds.size(), -1) < 0) {
+                if (errno == EINTR) continue;
+                aurora::log::debug()->error("Socket watcher failed, sockets will only be read on poll()");
+                return;
+            }
+
+            if (fds[0].revents & POLLIN) {
+                char buf[64];
+                while (read(wakePipe[0], buf, sizeof(buf)) > 0) {}
+                continue;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(watchMutex);
+                wakePending = true;
+            }
+            wakeHandler();
+        }
+    }
+
 } // namespace aurora::debug
\ No newline at end of file
@@ -2,13 +2,12 @@
 
 #include "aurora_engine/core/aurora_device.hpp"
 #include "aurora_engine/core/aurora_buffer.hpp"
+#include "aurora_engine/core/aurora_offset_allocator.hpp"
 
 #include <vector>
 #include <memory>
 #include <mutex>
 
-#include <map>
-
 namespace aurora {
 
     struct BufferAllocation {
@@ -19,17 +18,24 @@ namespace aurora {
         
         uint32_t pageId;
         VkDeviceSize pageOffset;
+        uint32_t blockId;
 
         bool isValid() const { return buffer != VK_NULL_HANDLE; }
     };
 
     class AuroraBufferPool {
     public:
+        enum class Strategy {
+            FirstFit,
+            Tlsf
+        };
+
         AuroraBufferPool(
             AuroraDevice& device,
             VkDeviceSize pageSize = 64 * 1024 * 1024,
             VkBufferUsageFlags usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
-            VkMemoryPropertyFlags memoryProperties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+            VkMemoryPropertyFlags memoryProperties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+            Strategy strategy = Strategy::Tlsf
         );
         
         ~AuroraBufferPool();
@@ -37,22 +43,21 @@ namespace aurora {
         BufferAllocation allocate(VkDeviceSize size, VkDeviceSize alignment = 256);
         void free(const BufferAllocation& allocation);
 
+        Strategy getStrategy() const { return strategy; }
+        static std::unique_ptr<AuroraOffsetAllocator> createOffsetAllocator(Strategy strategy, VkDeviceSize size);
+
     private:
         struct Page {
             std::unique_ptr<AuroraBuffer> buffer;
             VkDeviceSize size;
-            VkDeviceSize allocatedSize;
-            
-            std::map<VkDeviceSize, VkDeviceSize> freeMap;
-
-            bool allocate(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize& outOffset);
-            void free(VkDeviceSize offset, VkDeviceSize size);
+            std::unique_ptr<AuroraOffsetAllocator> allocator;
         };
 
         AuroraDevice& device;
         VkDeviceSize pageSize;
         VkBufferUsageFlags usage;
         VkMemoryPropertyFlags memoryProperties;
+        Strategy strategy;
         
         std::vector<std::unique_ptr<Page>> pages;
         std::mutex poolMutex;
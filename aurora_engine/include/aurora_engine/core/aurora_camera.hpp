@@ -12,7 +12,13 @@ namespace aurora {
             const glm::mat4 &getProjection() const {
                 return projectionMatrix;
             }
+
+            // World-space rect the projection shows, as (min.x, min.y, max.x, max.y)
+            const glm::vec4 &getViewBounds() const {
+                return viewBounds;
+            }
         private:
             glm::mat4 projectionMatrix{1.0f};
+            glm::vec4 viewBounds{-1.0f, -1.0f, 1.0f, 1.0f};
     };
 }
\ No newline at end of file
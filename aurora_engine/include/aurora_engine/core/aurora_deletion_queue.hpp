@@ -0,0 +1,56 @@
+#pragma once
+
+#include "aurora_engine/core/aurora_device.hpp"
+#include "aurora_engine/core/aurora_buffer_pool.hpp"
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace aurora {
+
+    // Defers destruction of GPU resources until every frame that may still reference them has
+    // retired. Entries are tagged with the most recently started frame and released from
+    // beginFrame() once the fence of that frame's slot has been waited on.
+    class AuroraDeletionQueue {
+    public:
+        AuroraDeletionQueue(AuroraDevice& device, uint32_t frameCount);
+        ~AuroraDeletionQueue();
+
+        AuroraDeletionQueue(const AuroraDeletionQueue&) = delete;
+        AuroraDeletionQueue& operator=(const AuroraDeletionQueue&) = delete;
+
+        void push(std::function<void()> deleter);
+
+        void freeBuffer(AuroraBufferPool& pool, const BufferAllocation& allocation);
+        void destroyPipeline(VkPipeline pipeline);
+        void destroyPipelineLayout(VkPipelineLayout pipelineLayout);
+        void destroyShaderModule(VkShaderModule shaderModule);
+        void freeDescriptorSets(VkDescriptorPool descriptorPool, std::vector<VkDescriptorSet> descriptorSets);
+        void destroyDescriptorPool(VkDescriptorPool descriptorPool);
+
+        void beginFrame(uint32_t frameIndex);
+        void flush();
+
+        uint64_t getCurrentFrame() const { return currentFrame; }
+        size_t getPendingCount() const;
+
+    private:
+        struct Entry {
+            uint64_t retireFrame;
+            std::function<void()> deleter;
+        };
+
+        void releaseUpTo(uint64_t completedFrame);
+
+        AuroraDevice& device;
+
+        std::deque<Entry> entries;
+        mutable std::mutex queueMutex;
+
+        std::vector<uint64_t> slotFrames;
+        uint64_t currentFrame = 0;
+    };
+
+}
@@ -15,13 +15,27 @@ namespace aurora {
     struct QueueFamilyIndices {
         uint32_t graphicsFamily = 0;
         uint32_t presentFamily = 0;
+        uint32_t graphicsTimestampValidBits = 0;
         bool graphicsFamilyHasValue = false;
         bool presentFamilyHasValue = false;
         bool isComplete() { return graphicsFamilyHasValue && presentFamilyHasValue; }
     };
 
+    // Render target quality. MSAA is clamped to what the device supports, VK_SAMPLE_COUNT_1_BIT
+    // turns it off; a render scale below 1 renders at a lower resolution and upscales on present.
+    struct RenderQuality {
+        VkSampleCountFlagBits msaaSamples = VK_SAMPLE_COUNT_8_BIT;
+        float renderScale = 1.0f;
+        VkPresentModeKHR presentMode = VK_PRESENT_MODE_MAILBOX_KHR;
+
+        static constexpr float MIN_RENDER_SCALE = 0.25f;
+    };
+
     class AuroraBufferPool;
     class AuroraBuffer;
+    class AuroraUploadQueue;
+    class AuroraDeletionQueue;
+    class AuroraPipelineCache;
 
     class AuroraDevice {
         public:
@@ -50,10 +64,14 @@ namespace aurora {
             AuroraBufferPool& getStagingBufferPool() { return *stagingBufferPool; }
             AuroraBufferPool& getDynamicVertexBufferPool() { return *dynamicVertexBufferPool; }
             AuroraBufferPool& getDynamicIndexBufferPool() { return *dynamicIndexBufferPool; }
+            AuroraUploadQueue& getUploadQueue() { return *uploadQueue; }
+            AuroraDeletionQueue& getDeletionQueue() { return *deletionQueue; }
+            AuroraPipelineCache& getPipelineCache() { return *pipelineCache; }
 
             SwapChainSupportDetails getSwapChainSupport() { return querySwapChainSupport(physicalDevice); }
             QueueFamilyIndices findPhysicalQueueFamilies() { return findQueueFamilies(physicalDevice); }
             VkFormat findSupportedFormat(const std::vector<VkFormat> &candidates, VkImageTiling tiling, VkFormatFeatureFlags features);
+            VkFormatProperties getFormatProperties(VkFormat format);
 
             void createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer &buffer, VkDeviceMemory &bufferMemory);
             VkCommandBuffer beginSingleTimeCommands();
@@ -62,10 +80,18 @@ namespace aurora {
             void copyBufferToImage(VkBuffer buffer, VkImage image, uint32_t width, uint32_t height, uint32_t layerCount);
 
             void createImageWithInfo(const VkImageCreateInfo &imageInfo, VkMemoryPropertyFlags properties, VkImage &image, VkDeviceMemory &imageMemory);
+            // Backs a TRANSIENT_ATTACHMENT image with lazily allocated memory when the device offers it,
+            // returns false if it fell back to regular device local memory
+            bool createTransientImage(const VkImageCreateInfo &imageInfo, VkImage &image, VkDeviceMemory &imageMemory);
+
+            // Takes effect once the swap chain and pipelines are rebuilt
+            void setRenderQuality(const RenderQuality &quality);
+            const RenderQuality& getRenderQuality() const { return renderQuality; }
 
             VkPhysicalDeviceProperties properties;
             VkPhysicalDeviceMemoryProperties memoryProperties;
             VkSampleCountFlagBits msaaSamples = VK_SAMPLE_COUNT_1_BIT;
+            VkSampleCountFlagBits maxMsaaSamples = VK_SAMPLE_COUNT_1_BIT;
 
         private:
             friend class AuroraBuffer;
@@ -97,6 +123,8 @@ namespace aurora {
             VkQueue graphicsQueue_;
             VkQueue presentQueue_;
 
+            RenderQuality renderQuality;
+
             const std::vector<const char *> validationLayers = {"VK_LAYER_KHRONOS_validation"};
             const std::vector<const char *> deviceExtensions = {VK_KHR_SWAPCHAIN_EXTENSION_NAME};
 
@@ -105,5 +133,8 @@ namespace aurora {
             std::unique_ptr<AuroraBufferPool> stagingBufferPool;
             std::unique_ptr<AuroraBufferPool> dynamicVertexBufferPool;
             std::unique_ptr<AuroraBufferPool> dynamicIndexBufferPool;
+            std::unique_ptr<AuroraUploadQueue> uploadQueue;
+            std::unique_ptr<AuroraDeletionQueue> deletionQueue;
+            std::unique_ptr<AuroraPipelineCache> pipelineCache;
     };
 }
\ No newline at end of file
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "aurora_engine/core/aurora_device.hpp"
+#include "aurora_engine/core/aurora_buffer_pool.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace aurora {
+
+    // Persistent instance data split into ranges, one per owner (usually a component). A CPU copy
+    // holds the current contents and every frame in flight owns a mapped copy on the GPU side.
+    // Rewriting a range marks it pending for all frame copies; upload() then only copies the
+    // ranges its frame has not seen yet, so steady-state cost follows the number of changes.
+    class AuroraInstanceStore {
+    public:
+        static constexpr uint32_t INVALID_RANGE = UINT32_MAX;
+
+        AuroraInstanceStore(AuroraDevice& device, VkDeviceSize stride, uint32_t frameCount);
+        ~AuroraInstanceStore();
+
+        AuroraInstanceStore(const AuroraInstanceStore&) = delete;
+        AuroraInstanceStore& operator=(const AuroraInstanceStore&) = delete;
+
+        // Discards every range; ranges added afterwards are laid out back to back in call order
+        void clear();
+        uint32_t addRange(const void* data, uint32_t count);
+
+        // Overwrites a range in place. Returns false when the count differs, the caller then has to
+        // lay the store out again.
+        bool writeRange(uint32_t range, const void* data, uint32_t count);
+
+        // Zeroes a range, which the shaders turn into degenerate primitives
+        void clearRange(uint32_t range);
+
+        // Brings the copy of this frame up to date; must not run while that frame is in flight
+        void upload(uint32_t frameIndex);
+
+        VkBuffer getBuffer(uint32_t frameIndex) const { return frames[frameIndex].allocation.buffer; }
+        VkDeviceSize getOffset(uint32_t frameIndex, uint32_t firstInstance = 0) const {
+            return frames[frameIndex].allocation.offset + firstInstance * stride;
+        }
+
+        uint32_t getFirstInstance(uint32_t range) const { return ranges[range].first; }
+        uint32_t getInstanceCount(uint32_t range) const { return ranges[range].count; }
+        uint32_t getInstanceCount() const { return instanceCount; }
+        uint32_t getRangeCount() const { return static_cast<uint32_t>(ranges.size()); }
+
+    private:
+        struct Range {
+            uint32_t first;
+            uint32_t count;
+            // One bit per frame copy that still has to receive this range
+            uint32_t pendingFrames;
+        };
+
+        struct FrameCopy {
+            BufferAllocation allocation{};
+            uint32_t capacity = 0;
+            bool needsFullUpload = true;
+        };
+
+        void markPending(uint32_t range);
+
+        AuroraDevice& device;
+        VkDeviceSize stride;
+        uint32_t allFramesMask;
+
+        std::vector<uint8_t> data;
+        std::vector<Range> ranges;
+        std::vector<uint32_t> pendingRanges;
+        uint32_t instanceCount = 0;
+
+        std::vector<FrameCopy> frames;
+    };
+
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace aurora {
+
+    // Work-stealing thread pool sized to the machine. Every worker owns a deque: it pushes and pops
+    // its own jobs at the back and steals from the front of the others when it runs dry. Threads
+    // that are not workers (the main thread) share queue 0 and run jobs while they wait, so a
+    // frame never blocks on work it could have done itself.
+    class AuroraJobSystem {
+    public:
+        using JobFunction = std::function<void()>;
+        using RangeFunction = std::function<void(size_t begin, size_t end)>;
+
+    private:
+        struct Job {
+            JobFunction function;
+            uint32_t zoneId = 0;
+
+            // Starts at 1 so the job cannot run while its dependencies are still being registered
+            std::atomic<uint32_t> unfinishedDependencies{1};
+            std::atomic<bool> finished{false};
+            std::exception_ptr error;
+
+            std::mutex continuationMutex;
+            std::vector<std::shared_ptr<Job>> continuations;
+        };
+
+    public:
+        class JobHandle {
+        public:
+            JobHandle() = default;
+
+            bool isValid() const { return job != nullptr; }
+            bool isDone() const { return !job || job->finished.load(std::memory_order_acquire); }
+
+        private:
+            friend class AuroraJobSystem;
+            explicit JobHandle(std::shared_ptr<Job> job) : job{std::move(job)} {}
+
+            std::shared_ptr<Job> job;
+        };
+
+        static AuroraJobSystem& instance() {
+            static AuroraJobSystem instance;
+            return instance;
+        }
+
+        AuroraJobSystem(const AuroraJobSystem&) = delete;
+        AuroraJobSystem& operator=(const AuroraJobSystem&) = delete;
+
+        // The job runs inside a profiler zone named after it, once every dependency has finished
+        JobHandle schedule(const char* name, JobFunction function, const std::vector<JobHandle>& dependencies = {});
+
+        // Runs other jobs on the calling thread until the handle finishes; rethrows the job's exception
+        void wait(const JobHandle& handle);
+        void waitAll(const std::vector<JobHandle>& handles);
+
+        // Splits [0, count) into ranges of at most grainSize and blocks until all have run
+        void parallelFor(const char* name, size_t count, size_t grainSize, const RangeFunction& function);
+
+        // Worker threads plus the calling thread
+        uint32_t getThreadCount() const { return static_cast<uint32_t>(workers.size()) + 1; }
+
+        // Publishes queue depth, steals and executed jobs since the last call as profiler counters
+        void publishStatistics();
+
+    private:
+        struct WorkerQueue {
+            std::mutex mutex;
+            std::deque<std::shared_ptr<Job>> jobs;
+        };
+
+        AuroraJobSystem();
+        ~AuroraJobSystem();
+
+        void workerMain(uint32_t queueIndex);
+        void enqueue(std::shared_ptr<Job> job);
+        std::shared_ptr<Job> popLocal(uint32_t queueIndex);
+        std::shared_ptr<Job> steal(uint32_t queueIndex);
+        std::shared_ptr<Job> findJob(uint32_t queueIndex);
+        void execute(const std::shared_ptr<Job>& job);
+        uint32_t currentQueueIndex() const;
+
+        std::vector<std::unique_ptr<WorkerQueue>> queues;
+        std::vector<std::thread> workers;
+
+        std::mutex sleepMutex;
+        std::condition_variable sleepCondition;
+        std::atomic<uint32_t> queuedJobs{0};
+        bool stopping = false;
+
+        std::atomic<uint32_t> maxQueueDepth{0};
+        std::atomic<uint64_t> stealCount{0};
+        std::atomic<uint64_t> executedCount{0};
+    };
+
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace aurora {
+
+    // Sub-allocates offsets inside a fixed size range (one AuroraBufferPool page).
+    // blockId is an opaque handle returned by allocate() that must be passed back to free().
+    class AuroraOffsetAllocator {
+    public:
+        virtual ~AuroraOffsetAllocator() = default;
+
+        virtual bool allocate(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize& outOffset, uint32_t& outBlockId) = 0;
+        virtual void free(VkDeviceSize offset, VkDeviceSize size, uint32_t blockId) = 0;
+
+        VkDeviceSize getAllocatedSize() const { return allocatedSize; }
+
+    protected:
+        VkDeviceSize allocatedSize = 0;
+    };
+
+    // First-fit walk over an offset ordered free list, O(free blocks) per allocation.
+    class AuroraFirstFitAllocator : public AuroraOffsetAllocator {
+    public:
+        explicit AuroraFirstFitAllocator(VkDeviceSize size);
+
+        bool allocate(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize& outOffset, uint32_t& outBlockId) override;
+        void free(VkDeviceSize offset, VkDeviceSize size, uint32_t blockId) override;
+
+    private:
+        std::map<VkDeviceSize, VkDeviceSize> freeMap;
+    };
+
+    // Two-level segregated fit allocator: free blocks are binned by size class (log2 of the size,
+    // then 2^SL_BITS linear subdivisions) and located through two bitmaps, so both allocate and
+    // free run in O(1). Physical neighbours are coalesced on free.
+    class AuroraTlsfAllocator : public AuroraOffsetAllocator {
+    public:
+        static constexpr VkDeviceSize GRANULARITY = 256;
+
+        explicit AuroraTlsfAllocator(VkDeviceSize size);
+
+        bool allocate(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize& outOffset, uint32_t& outBlockId) override;
+        void free(VkDeviceSize offset, VkDeviceSize size, uint32_t blockId) override;
+
+    private:
+        static constexpr uint32_t SL_BITS = 4;
+        static constexpr uint32_t SL_COUNT = 1u << SL_BITS;
+        static constexpr uint32_t FL_COUNT = 32;
+        static constexpr uint32_t NO_BLOCK = UINT32_MAX;
+
+        struct Block {
+            VkDeviceSize offset;
+            VkDeviceSize size;
+            uint32_t prevPhysical;
+            uint32_t nextPhysical;
+            uint32_t prevFree;
+            uint32_t nextFree;
+            bool isFree;
+        };
+
+        static void mappingInsert(VkDeviceSize size, uint32_t& fl, uint32_t& sl);
+        static void mappingSearch(VkDeviceSize size, uint32_t& fl, uint32_t& sl);
+
+        uint32_t findFreeBlock(uint32_t& fl, uint32_t& sl) const;
+        uint32_t createBlock(VkDeviceSize offset, VkDeviceSize size);
+        void releaseBlock(uint32_t index);
+        void insertFreeBlock(uint32_t index);
+        void removeFreeBlock(uint32_t index);
+        uint32_t splitBlock(uint32_t index, VkDeviceSize size);
+
+        std::vector<Block> blocks;
+        std::vector<uint32_t> unusedBlocks;
+
+        uint32_t flBitmap = 0;
+        std::array<uint32_t, FL_COUNT> slBitmap{};
+        std::array<std::array<uint32_t, SL_COUNT>, FL_COUNT> freeLists;
+    };
+
+}
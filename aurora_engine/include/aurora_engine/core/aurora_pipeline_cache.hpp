@@ -0,0 +1,53 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace aurora {
+    class AuroraDevice;
+
+    // Device-wide VkPipelineCache persisted between runs, and the shader modules pipelines are built
+    // from. The file is only loaded back on the same device and driver version; anything else starts
+    // with an empty cache. Shader modules are loaded once per path and kept until the device goes.
+    class AuroraPipelineCache {
+        public:
+            static constexpr const char* DEFAULT_PATH = "pipeline_cache.bin";
+
+            AuroraPipelineCache(AuroraDevice& device, std::string cachePath = DEFAULT_PATH);
+            // Saves the cache; every pipeline built from it must be gone
+            ~AuroraPipelineCache();
+
+            AuroraPipelineCache(const AuroraPipelineCache&) = delete;
+            AuroraPipelineCache& operator=(const AuroraPipelineCache&) = delete;
+
+            // Vulkan synchronizes access internally, pipelines may be created from any thread
+            VkPipelineCache getCache() const { return pipelineCache; }
+
+            // Thread safe
+            VkShaderModule getShaderModule(const std::string& filePath);
+
+            // Writes the cache to disk if pipelines were added since it was loaded or last saved
+            void save();
+
+            bool wasLoadedFromDisk() const { return loadedFromDisk; }
+            size_t getShaderModuleCount() const;
+
+        private:
+            bool loadCacheData(std::vector<char>& data) const;
+            static std::vector<char> readFile(const std::string& filePath);
+
+            AuroraDevice& device;
+            std::string cachePath;
+
+            VkPipelineCache pipelineCache = VK_NULL_HANDLE;
+            bool loadedFromDisk = false;
+            size_t savedSize = 0;
+
+            mutable std::mutex shaderModuleMutex;
+            std::unordered_map<std::string, VkShaderModule> shaderModules;
+    };
+}
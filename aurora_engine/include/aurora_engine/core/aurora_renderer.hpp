@@ -3,6 +3,8 @@
 #include "aurora_window.hpp"
 #include "aurora_device.hpp"
 #include "aurora_swap_chain.hpp"
+#include "aurora_secondary_command_buffers.hpp"
+#include "aurora_engine/profiling/aurora_gpu_profiler.hpp"
 
 #define GLM_FORCE_RADIANS
 #define GLM_FORCE_DEPTH_ZERO_TO_ONE
@@ -15,6 +17,8 @@
 namespace aurora {
     class AuroraRenderer {
         public:
+            static constexpr uint32_t MAX_RECORDING_THREADS = 4;
+
             AuroraRenderer(AuroraWindow& window, AuroraDevice& device, const glm::vec4& backgroundColor);
             ~AuroraRenderer();
 
@@ -25,7 +29,11 @@ namespace aurora {
             float getAspectRatio() const { return auroraSwapChain->extentAspectRatio(); }
             uint32_t getWidth() const { return auroraSwapChain->width(); }
             uint32_t getHeight() const { return auroraSwapChain->height(); }
+            VkExtent2D getRenderExtent() const { return auroraSwapChain->getRenderExtent(); }
+            VkDeviceSize getAttachmentMemorySize() const { return auroraSwapChain->getAttachmentMemorySize(); }
             bool isFrameInProgress() const { return isFrameStarted; }
+            AuroraGpuProfiler& getGpuProfiler() { return *gpuProfiler; }
+            uint32_t getRecordingThreadCount() const { return secondaryCommandBuffers->getThreadCount(); }
 
             VkCommandBuffer getCurrentCommandBuffer() const {
                 assert(isFrameStarted && "Frame has not started yet");
@@ -40,22 +48,37 @@ namespace aurora {
             VkCommandBuffer beginFrame();
             void endFrame();
 
-            void beginSwapChainRenderPass(VkCommandBuffer commandBuffer);
+            void beginSwapChainRenderPass(VkCommandBuffer commandBuffer, VkSubpassContents contents = VK_SUBPASS_CONTENTS_INLINE);
             void endSwapChainRenderPass(VkCommandBuffer commandBuffer);
 
+            // Secondary command buffers continue the current swap chain render pass, which must have been
+            // begun with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS. Each recording thread passes its own
+            // index below getRecordingThreadCount(); viewport and scissor are already set.
+            VkCommandBuffer beginSecondaryCommandBuffer(uint32_t threadIndex);
+            void endSecondaryCommandBuffer(VkCommandBuffer commandBuffer);
+            void executeSecondaryCommandBuffers(VkCommandBuffer commandBuffer, const std::vector<VkCommandBuffer>& secondaryBuffers);
+
+            // Rebuilds the swap chain at the start of the next frame, e.g. after the render quality changed
+            void requestSwapChainRecreation() { swapChainRecreationRequested = true; }
+
         private:
             void createCommandBuffers();
             void freeCommandBuffers();
             void recreateSwapChain();
+            void setViewportAndScissor(VkCommandBuffer commandBuffer);
 
             AuroraWindow& auroraWindow;
             AuroraDevice& auroraDevice;
             std::unique_ptr<AuroraSwapChain> auroraSwapChain;
             std::vector<VkCommandBuffer> commandBuffers;
+            std::unique_ptr<AuroraGpuProfiler> gpuProfiler;
+            std::unique_ptr<AuroraSecondaryCommandBuffers> secondaryCommandBuffers;
             glm::vec4 backgroundColor;
 
             uint32_t currentImageIndex;
             int currentFrameIndex;
+            uint32_t renderPassZone = AuroraGpuProfiler::INVALID_ZONE;
             bool isFrameStarted;
+            bool swapChainRecreationRequested = false;
     };
 }
\ No newline at end of file
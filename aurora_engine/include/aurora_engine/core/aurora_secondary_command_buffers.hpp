@@ -0,0 +1,42 @@
+#pragma once
+
+#include "aurora_engine/core/aurora_device.hpp"
+
+#include <vector>
+
+namespace aurora {
+
+    // Secondary command buffers for recording a render pass from several threads. Every frame in
+    // flight owns one command pool per recording slot; a slot is used by one thread at a time, so
+    // pools are never shared concurrently and a frame's pools are reset once its fence has signaled.
+    class AuroraSecondaryCommandBuffers {
+    public:
+        AuroraSecondaryCommandBuffers(AuroraDevice& device, uint32_t threadCount, uint32_t frameCount);
+        ~AuroraSecondaryCommandBuffers();
+
+        AuroraSecondaryCommandBuffers(const AuroraSecondaryCommandBuffers&) = delete;
+        AuroraSecondaryCommandBuffers& operator=(const AuroraSecondaryCommandBuffers&) = delete;
+
+        void beginFrame(uint32_t frameIndex);
+
+        // Only one thread at a time may record with a given threadIndex
+        VkCommandBuffer begin(uint32_t threadIndex, const VkCommandBufferInheritanceInfo& inheritanceInfo);
+
+        uint32_t getThreadCount() const { return threadCount; }
+
+    private:
+        struct ThreadPool {
+            VkCommandPool commandPool = VK_NULL_HANDLE;
+            std::vector<VkCommandBuffer> commandBuffers;
+            size_t used = 0;
+        };
+
+        AuroraDevice& device;
+        uint32_t threadCount;
+
+        // Indexed [frame][thread]
+        std::vector<std::vector<ThreadPool>> frames;
+        uint32_t currentFrame = 0;
+    };
+
+}
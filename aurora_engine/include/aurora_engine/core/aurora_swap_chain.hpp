@@ -26,6 +26,16 @@ namespace aurora {
             uint32_t width() { return swapChainExtent.width; }
             uint32_t height() { return swapChainExtent.height; }
 
+            // Extent of the attachments the scene is rendered into, smaller than the swap chain
+            // extent when a render scale below 1 is active
+            VkExtent2D getRenderExtent() { return renderExtent; }
+            bool isUpscaling() const { return upscaling; }
+            VkDeviceSize getAttachmentMemorySize() const { return attachmentMemorySize; }
+            VkDeviceSize getTransientMemorySize() const { return transientMemorySize; }
+
+            // Blits the scaled scene image onto the swap chain image, recorded after the render pass
+            void recordUpscale(VkCommandBuffer commandBuffer, uint32_t imageIndex);
+
             float extentAspectRatio() {
                 return static_cast<float>(swapChainExtent.width) / static_cast<float>(swapChainExtent.height);
             }
@@ -44,9 +54,14 @@ namespace aurora {
             void createImageViews();
             void createColorResources();
             void createDepthResources();
+            void createSceneResources();
             void createRenderPass();
             void createFramebuffers();
             void createSyncObjects();
+            void createAttachmentImage(const VkImageCreateInfo &imageInfo, VkImageAspectFlags aspectMask, VkImage &image, VkDeviceMemory &imageMemory, VkImageView &imageView);
+            void createTransientAttachmentImage(const VkImageCreateInfo &imageInfo, VkImageAspectFlags aspectMask, VkImage &image, VkDeviceMemory &imageMemory, VkImageView &imageView);
+            void createImageView(VkImage image, VkFormat format, VkImageAspectFlags aspectMask, VkImageView &imageView);
+            bool supportsUpscale(const SwapChainSupportDetails &swapChainSupport, VkFormat format);
 
             VkSurfaceFormatKHR chooseSwapSurfaceFormat(const std::vector<VkSurfaceFormatKHR> &availableFormats);
             VkPresentModeKHR chooseSwapPresentMode(const std::vector<VkPresentModeKHR> &availablePresentModes);
@@ -55,20 +70,31 @@ namespace aurora {
             VkFormat swapChainImageFormat;
             VkFormat swapChainDepthFormat;
             VkExtent2D swapChainExtent;
+            VkExtent2D renderExtent;
+            bool upscaling = false;
+            VkDeviceSize attachmentMemorySize = 0;
+            VkDeviceSize transientMemorySize = 0;
+            bool transientLazilyAllocated = true;
 
             std::vector<VkFramebuffer> swapChainFramebuffers;
             VkRenderPass renderPass;
 
-            std::vector<VkImage> depthImages;
-            std::vector<VkDeviceMemory> depthImageMemorys;
-            std::vector<VkImageView> depthImageViews;
+            // The MSAA color and depth attachments never outlive the render pass, so a single pair is
+            // shared by every framebuffer; the external subpass dependency orders consecutive frames
+            VkImage depthImage = VK_NULL_HANDLE;
+            VkDeviceMemory depthImageMemory = VK_NULL_HANDLE;
+            VkImageView depthImageView = VK_NULL_HANDLE;
             std::vector<VkImage> swapChainImages;
             std::vector<VkImageView> swapChainImageViews;
             
             
-            std::vector<VkImage> colorImages;
-            std::vector<VkDeviceMemory> colorImageMemorys;
-            std::vector<VkImageView> colorImageViews;
+            VkImage colorImage = VK_NULL_HANDLE;
+            VkDeviceMemory colorImageMemory = VK_NULL_HANDLE;
+            VkImageView colorImageView = VK_NULL_HANDLE;
+
+            std::vector<VkImage> sceneImages;
+            std::vector<VkDeviceMemory> sceneImageMemorys;
+            std::vector<VkImageView> sceneImageViews;
 
             AuroraDevice &device;
             VkExtent2D windowExtent;
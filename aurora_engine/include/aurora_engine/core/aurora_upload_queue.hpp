@@ -0,0 +1,57 @@
+#pragma once
+
+#include "aurora_engine/core/aurora_device.hpp"
+#include "aurora_engine/core/aurora_buffer_pool.hpp"
+
+#include <deque>
+#include <vector>
+
+namespace aurora {
+
+    // Collects staging -> device-local copies and submits them as a single batch ahead of the
+    // frame's render submission. Staging memory is handed back to the pool once the batch fence
+    // has signaled, so uploads never block the CPU.
+    class AuroraUploadQueue {
+    public:
+        AuroraUploadQueue(AuroraDevice& device, AuroraBufferPool& stagingPool);
+        ~AuroraUploadQueue();
+
+        AuroraUploadQueue(const AuroraUploadQueue&) = delete;
+        AuroraUploadQueue& operator=(const AuroraUploadQueue&) = delete;
+
+        bool uploadBuffer(const BufferAllocation& destination, const void* data, VkDeviceSize size, VkDeviceSize destinationOffset = 0);
+        void cancel(const BufferAllocation& destination);
+
+        void submit();
+        void waitIdle();
+
+        size_t getPendingCount() const { return pendingCopies.size(); }
+        size_t getInFlightBatchCount() const { return inFlightBatches.size(); }
+
+    private:
+        struct PendingCopy {
+            BufferAllocation staging;
+            VkBuffer dstBuffer;
+            VkDeviceSize dstOffset;
+            VkDeviceSize size;
+        };
+
+        struct Batch {
+            VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+            VkFence fence = VK_NULL_HANDLE;
+            std::vector<BufferAllocation> stagingAllocations;
+        };
+
+        Batch acquireBatch();
+        void collectCompletedBatches();
+        void recycleBatch(Batch& batch);
+
+        AuroraDevice& device;
+        AuroraBufferPool& stagingPool;
+
+        std::vector<PendingCopy> pendingCopies;
+        std::deque<Batch> inFlightBatches;
+        std::vector<Batch> freeBatches;
+    };
+
+}
@@ -14,19 +14,24 @@ namespace aurora {
             AuroraWindow& operator=(const AuroraWindow&) = delete;
             
             bool shouldClose() { return glfwWindowShouldClose(window); }
+            void requestClose() { glfwSetWindowShouldClose(window, GLFW_TRUE); }
             VkExtent2D getExtent() { return {static_cast<uint32_t>(width), static_cast<uint32_t>(height)}; }
             bool wasWindowResized() { return framebufferResized; }
             void resetWindowResizedFlag() { framebufferResized = false; }
+            bool wasRefreshRequested() { return refreshRequested; }
+            void resetRefreshRequestedFlag() { refreshRequested = false; }
 
             void createWindowSurface(VkInstance instance, VkSurfaceKHR* surface);
 
         private:
             static void framebufferResizeCallback(GLFWwindow* window, int width, int height);
+            static void windowRefreshCallback(GLFWwindow* window);
             void initWindow();
 
             int width;
             int height;
             bool framebufferResized = false;
+            bool refreshRequested = false;
 
             std::string windowName;
             GLFWwindow* window;
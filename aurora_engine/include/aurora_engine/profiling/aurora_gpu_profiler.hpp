@@ -0,0 +1,71 @@
+#pragma once
+
+#include "aurora_engine/core/aurora_device.hpp"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace aurora {
+
+    // Brackets command buffer work with timestamp queries and publishes the measured GPU time as
+    // AuroraProfiler samples. Each frame in flight owns its own query pool, and results are read
+    // back when the slot is reused, after its fence has signaled, so the readback never stalls.
+    class AuroraGpuProfiler {
+    public:
+        static constexpr uint32_t MAX_ZONES = 64;
+        static constexpr uint32_t INVALID_ZONE = UINT32_MAX;
+        static constexpr const char* RENDER_PASS_ZONE = "GPU: Render Pass";
+
+        class Zone {
+        public:
+            Zone(AuroraGpuProfiler& profiler, VkCommandBuffer commandBuffer, const std::string& name)
+                : profiler{profiler}, commandBuffer{commandBuffer}, zone{profiler.beginZone(commandBuffer, name)} {}
+            ~Zone() { profiler.endZone(commandBuffer, zone); }
+
+            Zone(const Zone&) = delete;
+            Zone& operator=(const Zone&) = delete;
+
+        private:
+            AuroraGpuProfiler& profiler;
+            VkCommandBuffer commandBuffer;
+            uint32_t zone;
+        };
+
+        AuroraGpuProfiler(AuroraDevice& device, uint32_t frameCount);
+        ~AuroraGpuProfiler();
+
+        AuroraGpuProfiler(const AuroraGpuProfiler&) = delete;
+        AuroraGpuProfiler& operator=(const AuroraGpuProfiler&) = delete;
+
+        // Must be recorded outside of a render pass, before any zone of the frame
+        void beginFrame(VkCommandBuffer commandBuffer, uint32_t frameIndex);
+
+        uint32_t beginZone(VkCommandBuffer commandBuffer, const std::string& name);
+        void endZone(VkCommandBuffer commandBuffer, uint32_t zone);
+
+        bool isSupported() const { return supported; }
+
+    private:
+        struct FrameQueries {
+            VkQueryPool queryPool = VK_NULL_HANDLE;
+            std::vector<std::string> zoneNames;
+            // Zones may be opened from several threads recording secondary command buffers
+            std::atomic<uint32_t> zoneCount{0};
+            bool submitted = false;
+        };
+
+        void collectResults(FrameQueries& frame);
+
+        AuroraDevice& device;
+
+        std::vector<FrameQueries> frames;
+        std::vector<uint64_t> timestamps;
+        uint32_t currentFrame = 0;
+
+        bool supported = false;
+        double timestampPeriodMs = 0.0;
+        uint64_t timestampMask = 0;
+    };
+
+}
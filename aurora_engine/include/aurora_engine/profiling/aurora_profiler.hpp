@@ -6,6 +6,9 @@
 #include <atomic>
 #include <mutex>
 #include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
 
 namespace aurora {
     class AuroraProfiler {
@@ -28,21 +31,38 @@ namespace aurora {
             }
         };
 
+        static constexpr uint32_t NO_PARENT = std::numeric_limits<uint32_t>::max();
+
+        // One completed zone, recorded with its nesting on the thread that ran it
+        struct TraceZone {
+            uint32_t zoneId;
+            uint32_t parentZoneId;
+            uint32_t threadIndex;
+            uint32_t depth;
+            uint64_t startNs;
+            uint64_t endNs;
+        };
+
+        struct TraceFrame {
+            uint64_t frameNumber = 0;
+            uint64_t startNs = 0;
+            uint64_t endNs = 0;
+            std::vector<TraceZone> zones;
+        };
+
         struct ProfileBlock {
-            const char* name;
-            std::chrono::high_resolution_clock::time_point startTime;
+            uint32_t zoneId;
+            bool active;
             
-            ProfileBlock(const char* blockName) : name(blockName) {
-                if (AuroraProfiler::instance().isEnabled()) {
-                    startTime = std::chrono::high_resolution_clock::now();
+            ProfileBlock(uint32_t zone) : zoneId(zone), active(AuroraProfiler::instance().isEnabled()) {
+                if (active) {
+                    AuroraProfiler::instance().beginZone(zoneId);
                 }
             }
             
             ~ProfileBlock() {
-                if (AuroraProfiler::instance().isEnabled()) {
-                    auto endTime = std::chrono::high_resolution_clock::now();
-                    auto duration = std::chrono::duration<double, std::milli>(endTime - startTime).count();
-                    AuroraProfiler::instance().addSample(name, duration);
+                if (active) {
+                    AuroraProfiler::instance().endZone(zoneId);
                 }
             }
         };
@@ -52,8 +72,17 @@ namespace aurora {
             return instance;
         }
 
+        // Returns a stable ID for the zone name; AURORA_PROFILE caches it per call site
+        uint32_t internZone(const char* name);
+
+        // Lock-free on the calling thread; events are aggregated by newFrame()
+        void beginZone(uint32_t zoneId);
+        void endZone(uint32_t zoneId);
+        void addSample(uint32_t zoneId, double timeMs);
         void addSample(const char* name, double timeMs);
+
         const StatisticalData& getStats(const char* name) const;
+        void beginFrame();
         void newFrame();
         void setEnabled(bool enabled) { enabled_ = enabled; }
         bool isEnabled() const { return enabled_; }
@@ -63,29 +92,107 @@ namespace aurora {
         }
         double getFrameTime() const { return currentFrameTime_; }
 
+        // Counters are written during a frame; reads return the values of the frame newFrame() last completed
         void setCounter(const char* name, uint64_t value);
         void incrementCounter(const char* name, uint64_t value = 1);
         uint64_t getCounter(const char* name) const;
         const std::unordered_map<std::string, uint64_t>& getCounters() const;
         const std::unordered_map<std::string, StatisticalData>& getAllStats() const { return stats_; }
 
+        // Startup phases in the order they were first recorded; unlike counters they are never reset
+        void setStartupTime(const char* phase, double timeMs);
+        double getStartupTime(const char* phase) const;
+        std::vector<std::pair<std::string, double>> getStartupTimes() const;
+
+        // Keeps the zones of the last frameCount frames; 0 disables tracing
+        void setTraceFrameCount(size_t frameCount);
+        void setThreadName(const char* name);
+
+        // Writes the retained frames as Chrome Trace Event JSON (chrome://tracing, Perfetto)
+        bool exportChromeTrace(const std::string& path);
+
+        // Exports automatically when a frame takes longer than thresholdMs; 0 disables
+        void setSlowFrameCapture(double thresholdMs, const std::string& directory = ".");
+
     private:
+        enum class EventType : uint32_t { Begin, End, Sample };
+
+        struct Event {
+            uint32_t zoneId;
+            EventType type;
+            uint64_t value;
+        };
+
+        // Single producer (the owning thread), single consumer (newFrame)
+        struct ThreadEvents {
+            static constexpr uint32_t CAPACITY = 1 << 14;
+
+            Event events[CAPACITY];
+            std::atomic<uint32_t> head{0};
+            std::atomic<uint32_t> tail{0};
+            std::atomic<uint64_t> dropped{0};
+            std::atomic<bool> retired{false};
+
+            uint32_t threadIndex = 0;
+            std::string threadName;
+
+            struct OpenZone {
+                uint32_t zoneId;
+                uint64_t startNs;
+            };
+            std::vector<OpenZone> openZones;
+        };
+
+        static uint64_t nowNs() {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        ThreadEvents& threadEvents();
+        void pushEvent(uint32_t zoneId, EventType type, uint64_t value);
+        void drainEvents(ThreadEvents& buffer);
+        void accumulate(uint32_t zoneId, double timeMs);
+        void retireTraceFrame(uint64_t endNs);
+        bool writeChromeTrace(const std::string& path);
+
         AuroraProfiler() = default;
         ~AuroraProfiler() = default;
         AuroraProfiler(const AuroraProfiler&) = delete;
         AuroraProfiler& operator=(const AuroraProfiler&) = delete;
 
         std::unordered_map<std::string, StatisticalData> stats_;
+        std::unordered_map<std::string, uint32_t> zoneIds_;
+        std::vector<StatisticalData*> zoneStats_;
+        std::vector<const std::string*> zoneNames_;
+        std::vector<std::unique_ptr<ThreadEvents>> threadBuffers_;
+        std::mutex zoneMutex_;
         std::unordered_map<std::string, uint64_t> counters_;
+        std::unordered_map<std::string, uint64_t> frameCounters_;
+        std::vector<std::pair<std::string, double>> startupTimes_;
         std::atomic<bool> enabled_{true};
         std::mutex dataMutex_;
         double currentFrameTime_ = 0.0;
 
+        std::vector<TraceFrame> traceFrames_;
+        TraceFrame pendingTraceFrame_;
+        size_t traceFrameCount_ = DEFAULT_TRACE_FRAMES;
+        size_t traceCursor_ = 0;
+        uint64_t frameNumber_ = 0;
+        uint64_t frameStartNs_ = 0;
+
+        double slowFrameThresholdMs_ = 0.0;
+        std::string slowFrameDirectory_;
+        uint64_t nextCaptureFrame_ = 0;
+
         static constexpr uint32_t AVERAGE_WINDOW = 600;
+        static constexpr size_t DEFAULT_TRACE_FRAMES = 300;
+        static constexpr size_t MAX_TRACE_ZONES_PER_FRAME = 16384;
     };
 
     #ifdef AURORA_PROFILING_ENABLED
-        #define AURORA_PROFILE(name) AuroraProfiler::ProfileBlock _prof(name)
+        #define AURORA_PROFILE(name) \
+            static const uint32_t _prof_zone = AuroraProfiler::instance().internZone(name); \
+            AuroraProfiler::ProfileBlock _prof(_prof_zone)
     #else
         #define AURORA_PROFILE(name)
     #endif
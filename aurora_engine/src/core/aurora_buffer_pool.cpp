@@ -1,4 +1,5 @@
 #include "aurora_engine/core/aurora_buffer_pool.hpp"
+#include "aurora_engine/profiling/aurora_profiler.hpp"
 #include "aurora_engine/utils/log.hpp"
 
 namespace aurora {
@@ -7,8 +8,9 @@ namespace aurora {
         AuroraDevice& device,
         VkDeviceSize pageSize,
         VkBufferUsageFlags usage,
-        VkMemoryPropertyFlags memoryProperties)
-        : device{device}, pageSize{pageSize}, usage{usage}, memoryProperties{memoryProperties} {
+        VkMemoryPropertyFlags memoryProperties,
+        Strategy strategy)
+        : device{device}, pageSize{pageSize}, usage{usage}, memoryProperties{memoryProperties}, strategy{strategy} {
     }
 
     AuroraBufferPool::~AuroraBufferPool() {
@@ -17,16 +19,19 @@ namespace aurora {
 
     BufferAllocation AuroraBufferPool::allocate(VkDeviceSize size, VkDeviceSize alignment) {
         std::lock_guard<std::mutex> lock(poolMutex);
+        AuroraProfiler::instance().incrementCounter("Pool Map Ops");
 
         for (size_t i = 0; i < pages.size(); ++i) {
             VkDeviceSize offset;
-            if (pages[i]->allocate(size, alignment, offset)) {
+            uint32_t blockId;
+            if (pages[i]->allocator->allocate(size, alignment, offset, blockId)) {
                 BufferAllocation alloc{};
                 alloc.buffer = pages[i]->buffer->getBuffer();
                 alloc.offset = offset;
                 alloc.size = size;
                 alloc.pageId = static_cast<uint32_t>(i);
                 alloc.pageOffset = offset;
+                alloc.blockId = blockId;
                 
                 if (memoryProperties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) {
                     alloc.mappedMemory = static_cast<char*>(pages[i]->buffer->getMappedMemory()) + offset;
@@ -41,14 +46,16 @@ namespace aurora {
         createNewPage();
         
         VkDeviceSize offset;
+        uint32_t blockId;
         auto& newPage = pages.back();
-        if (newPage->allocate(size, alignment, offset)) {
+        if (newPage->allocator->allocate(size, alignment, offset, blockId)) {
             BufferAllocation alloc{};
             alloc.buffer = newPage->buffer->getBuffer();
             alloc.offset = offset;
             alloc.size = size;
             alloc.pageId = static_cast<uint32_t>(pages.size() - 1);
             alloc.pageOffset = offset;
+            alloc.blockId = blockId;
 
             if (memoryProperties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) {
                  alloc.mappedMemory = static_cast<char*>(newPage->buffer->getMappedMemory()) + offset;
@@ -65,9 +72,10 @@ namespace aurora {
 
     void AuroraBufferPool::free(const BufferAllocation& allocation) {
          std::lock_guard<std::mutex> lock(poolMutex);
+         AuroraProfiler::instance().incrementCounter("Pool Map Ops");
          
          if (allocation.pageId < pages.size()) {
-             pages[allocation.pageId]->free(allocation.pageOffset, allocation.size);
+             pages[allocation.pageId]->allocator->free(allocation.pageOffset, allocation.size, allocation.blockId);
          }
     }
 
@@ -87,68 +95,20 @@ namespace aurora {
         }
 
         page->size = pageSize;
-        page->allocatedSize = 0;
-        
-        page->freeMap.insert({0, pageSize});
+        page->allocator = createOffsetAllocator(strategy, pageSize);
         
         pages.push_back(std::move(page));
         log::engine()->debug("Allocated new Buffer Pool Page (ID: {})", pages.size() - 1);
     }
 
-    bool AuroraBufferPool::Page::allocate(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize& outOffset) {
-        for (auto it = freeMap.begin(); it != freeMap.end(); ++it) {
-            VkDeviceSize currentOffset = it->first;
-            VkDeviceSize currentSize = it->second;
-
-            VkDeviceSize alignedOffset = (currentOffset + alignment - 1) & ~(alignment - 1);
-            VkDeviceSize padding = alignedOffset - currentOffset;
-
-            if (currentSize >= size + padding) {
-                outOffset = alignedOffset;
-                VkDeviceSize remainingSize = currentSize - (size + padding);
-
-                freeMap.erase(it);
-
-                if (padding > 0) {
-                    freeMap[currentOffset] = padding;
-                }
-
-                if (remainingSize > 0) {
-                    freeMap[outOffset + size] = remainingSize;
-                }
-                
-                allocatedSize += size;
-                return true;
-            }
+    std::unique_ptr<AuroraOffsetAllocator> AuroraBufferPool::createOffsetAllocator(Strategy strategy, VkDeviceSize size) {
+        switch (strategy) {
+            case Strategy::FirstFit:
+                return std::make_unique<AuroraFirstFitAllocator>(size);
+            case Strategy::Tlsf:
+            default:
+                return std::make_unique<AuroraTlsfAllocator>(size);
         }
-        return false;
-    }
-
-    void AuroraBufferPool::Page::free(VkDeviceSize offset, VkDeviceSize size) {
-        auto next = freeMap.lower_bound(offset);
-        auto prev = (next == freeMap.begin()) ? freeMap.end() : std::prev(next);
-
-        bool mergedWithPrev = false;
-        if (prev != freeMap.end() && (prev->first + prev->second) == offset) {
-            prev->second += size;
-            mergedWithPrev = true;
-        }
-        if (next != freeMap.end() && (offset + size) == next->first) {
-            if (mergedWithPrev) {
-                prev->second += next->second;
-                freeMap.erase(next);
-            } else {
-                VkDeviceSize nextSize = next->second;
-                freeMap.erase(next);
-                freeMap[offset] = size + nextSize;
-            }
-        } else {
-            if (!mergedWithPrev) {
-                freeMap[offset] = size;
-            }
-        }
-        
-        allocatedSize -= size;
     }
 
 }
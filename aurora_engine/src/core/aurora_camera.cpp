@@ -1,5 +1,7 @@
 #include "aurora_engine/core/aurora_camera.hpp"
 
+#include <algorithm>
+
 namespace aurora {
     void AuroraCamera::setOrthographicProjection(float left, float right, float bottom, float top, float near, float far) {
         projectionMatrix = glm::mat4(1.0f);
@@ -9,5 +11,7 @@ namespace aurora {
         projectionMatrix[3][0] = -(right + left) / (right - left);
         projectionMatrix[3][1] = -(bottom + top) / (bottom - top);
         projectionMatrix[3][2] = -near / (far - near);
+
+        viewBounds = {std::min(left, right), std::min(bottom, top), std::max(left, right), std::max(bottom, top)};
     }
 }
\ No newline at end of file
@@ -0,0 +1,93 @@
+#include "aurora_engine/core/aurora_deletion_queue.hpp"
+#include "aurora_engine/profiling/aurora_profiler.hpp"
+
+#include <cassert>
+
+namespace aurora {
+
+    AuroraDeletionQueue::AuroraDeletionQueue(AuroraDevice& device, uint32_t frameCount)
+        : device{device}, slotFrames(frameCount, 0) {
+    }
+
+    AuroraDeletionQueue::~AuroraDeletionQueue() {
+        flush();
+    }
+
+    void AuroraDeletionQueue::push(std::function<void()> deleter) {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        entries.push_back({currentFrame, std::move(deleter)});
+    }
+
+    void AuroraDeletionQueue::freeBuffer(AuroraBufferPool& pool, const BufferAllocation& allocation) {
+        if (!allocation.isValid()) return;
+        push([&pool, allocation]() { pool.free(allocation); });
+    }
+
+    void AuroraDeletionQueue::destroyPipeline(VkPipeline pipeline) {
+        VkDevice vkDevice = device.device();
+        push([vkDevice, pipeline]() { vkDestroyPipeline(vkDevice, pipeline, nullptr); });
+    }
+
+    void AuroraDeletionQueue::destroyPipelineLayout(VkPipelineLayout pipelineLayout) {
+        VkDevice vkDevice = device.device();
+        push([vkDevice, pipelineLayout]() { vkDestroyPipelineLayout(vkDevice, pipelineLayout, nullptr); });
+    }
+
+    void AuroraDeletionQueue::destroyShaderModule(VkShaderModule shaderModule) {
+        VkDevice vkDevice = device.device();
+        push([vkDevice, shaderModule]() { vkDestroyShaderModule(vkDevice, shaderModule, nullptr); });
+    }
+
+    void AuroraDeletionQueue::freeDescriptorSets(VkDescriptorPool descriptorPool, std::vector<VkDescriptorSet> descriptorSets) {
+        if (descriptorSets.empty()) return;
+        VkDevice vkDevice = device.device();
+        push([vkDevice, descriptorPool, sets = std::move(descriptorSets)]() {
+            vkFreeDescriptorSets(vkDevice, descriptorPool, static_cast<uint32_t>(sets.size()), sets.data());
+        });
+    }
+
+    void AuroraDeletionQueue::destroyDescriptorPool(VkDescriptorPool descriptorPool) {
+        VkDevice vkDevice = device.device();
+        push([vkDevice, descriptorPool]() { vkDestroyDescriptorPool(vkDevice, descriptorPool, nullptr); });
+    }
+
+    void AuroraDeletionQueue::beginFrame(uint32_t frameIndex) {
+        assert(frameIndex < slotFrames.size() && "Frame index out of range");
+
+        // The fence guarding this slot has been waited on, so the frame that last used it, and
+        // every frame submitted before it, has completed on the GPU.
+        releaseUpTo(slotFrames[frameIndex]);
+
+        std::lock_guard<std::mutex> lock(queueMutex);
+        currentFrame++;
+        slotFrames[frameIndex] = currentFrame;
+    }
+
+    void AuroraDeletionQueue::flush() {
+        releaseUpTo(UINT64_MAX);
+    }
+
+    size_t AuroraDeletionQueue::getPendingCount() const {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        return entries.size();
+    }
+
+    void AuroraDeletionQueue::releaseUpTo(uint64_t completedFrame) {
+        std::deque<Entry> retired;
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            while (!entries.empty() && entries.front().retireFrame <= completedFrame) {
+                retired.push_back(std::move(entries.front()));
+                entries.pop_front();
+            }
+        }
+
+        // Deleters run outside the lock since destroying an object may queue further deletions
+        for (auto& entry : retired) {
+            entry.deleter();
+        }
+
+        AuroraProfiler::instance().incrementCounter("Deferred Deletions", retired.size());
+    }
+
+}
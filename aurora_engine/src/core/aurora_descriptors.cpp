@@ -1,4 +1,5 @@
 #include "aurora_engine/core/aurora_descriptors.hpp"
+#include "aurora_engine/core/aurora_deletion_queue.hpp"
 
 #include <cassert>
 #include <stdexcept>
@@ -73,7 +74,7 @@ namespace aurora {
     }
 
     AuroraDescriptorPool::~AuroraDescriptorPool() {
-        vkDestroyDescriptorPool(auroraDevice.device(), descriptorPool, nullptr);
+        auroraDevice.getDeletionQueue().destroyDescriptorPool(descriptorPool);
     }
 
     bool AuroraDescriptorPool::allocateDescriptor(const VkDescriptorSetLayout descriptorSetLayout, VkDescriptorSet &descriptor) const {
@@ -90,11 +91,7 @@ namespace aurora {
     }
 
     void AuroraDescriptorPool::freeDescriptors(std::vector<VkDescriptorSet> &descriptors) const {
-        vkFreeDescriptorSets(
-            auroraDevice.device(),
-            descriptorPool,
-            static_cast<uint32_t>(descriptors.size()),
-            descriptors.data());
+        auroraDevice.getDeletionQueue().freeDescriptorSets(descriptorPool, descriptors);
         }
 
         void AuroraDescriptorPool::resetPool() {
@@ -1,6 +1,11 @@
 #include "aurora_engine/core/aurora_device.hpp"
 #include "aurora_engine/core/aurora_buffer_pool.hpp"
+#include "aurora_engine/core/aurora_upload_queue.hpp"
+#include "aurora_engine/core/aurora_deletion_queue.hpp"
+#include "aurora_engine/core/aurora_pipeline_cache.hpp"
+#include "aurora_engine/core/aurora_swap_chain.hpp"
 
+#include <algorithm>
 #include <cstring>
 #include <set>
 #include <unordered_set>
@@ -84,9 +89,19 @@ namespace aurora {
             VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
             VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
         );
+
+        uploadQueue = std::make_unique<AuroraUploadQueue>(*this, *stagingBufferPool);
+        deletionQueue = std::make_unique<AuroraDeletionQueue>(*this, AuroraSwapChain::MAX_FRAMES_IN_FLIGHT);
+        pipelineCache = std::make_unique<AuroraPipelineCache>(*this);
     }
 
     AuroraDevice::~AuroraDevice() {
+        // Deferred deletions may still reference pooled buffers, so release them while the pools exist
+        vkDeviceWaitIdle(device_);
+        deletionQueue.reset();
+        // Saved once the deferred pipeline deletions above have run
+        pipelineCache.reset();
+        uploadQueue.reset();
         vertexBufferPool.reset();
         indexBufferPool.reset();
         stagingBufferPool.reset();
@@ -169,13 +184,31 @@ namespace aurora {
         vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memoryProperties);
 
         VkSampleCountFlags counts = properties.limits.framebufferColorSampleCounts & properties.limits.framebufferDepthSampleCounts;
-        if (counts & VK_SAMPLE_COUNT_8_BIT) { msaaSamples = VK_SAMPLE_COUNT_8_BIT; }
-        else if (counts & VK_SAMPLE_COUNT_4_BIT) { msaaSamples = VK_SAMPLE_COUNT_4_BIT; }
-        else if (counts & VK_SAMPLE_COUNT_2_BIT) { msaaSamples = VK_SAMPLE_COUNT_2_BIT; }
-        else { msaaSamples = VK_SAMPLE_COUNT_1_BIT; }
+        if (counts & VK_SAMPLE_COUNT_8_BIT) { maxMsaaSamples = VK_SAMPLE_COUNT_8_BIT; }
+        else if (counts & VK_SAMPLE_COUNT_4_BIT) { maxMsaaSamples = VK_SAMPLE_COUNT_4_BIT; }
+        else if (counts & VK_SAMPLE_COUNT_2_BIT) { maxMsaaSamples = VK_SAMPLE_COUNT_2_BIT; }
+        else { maxMsaaSamples = VK_SAMPLE_COUNT_1_BIT; }
 
         log::engine()->info("Selected physical device: {}", properties.deviceName);
-        log::engine()->info("Max MSAA samples: {}", static_cast<int>(msaaSamples));
+        log::engine()->info("Max MSAA samples: {}", static_cast<int>(maxMsaaSamples));
+
+        setRenderQuality(renderQuality);
+    }
+
+    void AuroraDevice::setRenderQuality(const RenderQuality &quality) {
+        renderQuality = quality;
+
+        // Sample counts are single bits, so the smaller of the two is the supported one
+        renderQuality.msaaSamples = std::min(quality.msaaSamples, maxMsaaSamples);
+        if (renderQuality.msaaSamples < VK_SAMPLE_COUNT_1_BIT) {
+            renderQuality.msaaSamples = VK_SAMPLE_COUNT_1_BIT;
+        }
+        renderQuality.renderScale = std::clamp(quality.renderScale, RenderQuality::MIN_RENDER_SCALE, 1.0f);
+
+        msaaSamples = renderQuality.msaaSamples;
+
+        log::engine()->info("Render quality: {}x MSAA, {:.0f}% render scale, present mode {}",
+            static_cast<int>(msaaSamples), renderQuality.renderScale * 100.0f, static_cast<int>(renderQuality.presentMode));
     }
 
     void AuroraDevice::createLogicalDevice() {
@@ -370,6 +403,7 @@ namespace aurora {
         for (const auto &queueFamily : queueFamilies) {
             if (queueFamily.queueCount > 0 && queueFamily.queueFlags & VK_QUEUE_GRAPHICS_BIT) {
                 indices.graphicsFamily = i;
+                indices.graphicsTimestampValidBits = queueFamily.timestampValidBits;
                 indices.graphicsFamilyHasValue = true;
             }
             VkBool32 presentSupport = false;
@@ -426,6 +460,12 @@ namespace aurora {
         throw std::runtime_error("failed to find supported format!");
     }
 
+    VkFormatProperties AuroraDevice::getFormatProperties(VkFormat format) {
+        VkFormatProperties props;
+        vkGetPhysicalDeviceFormatProperties(physicalDevice, format, &props);
+        return props;
+    }
+
     uint32_t AuroraDevice::findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties) {
         for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++) {
             if ((typeFilter & (1 << i)) && (memoryProperties.memoryTypes[i].propertyFlags & properties) == properties) {
@@ -554,4 +594,43 @@ namespace aurora {
             throw std::runtime_error("failed to bind image memory!");
         }
     }
+
+    bool AuroraDevice::createTransientImage(const VkImageCreateInfo &imageInfo, VkImage &image, VkDeviceMemory &imageMemory) {
+        if (vkCreateImage(device_, &imageInfo, nullptr, &image) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create image!");
+        }
+
+        VkMemoryRequirements memRequirements;
+        vkGetImageMemoryRequirements(device_, image, &memRequirements);
+
+        // Tile based GPUs keep transient attachments in on-chip memory and never commit these pages
+        VkMemoryPropertyFlags lazyProperties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT;
+        bool lazilyAllocated = false;
+        uint32_t memoryType = 0;
+        for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++) {
+            if ((memRequirements.memoryTypeBits & (1 << i)) && (memoryProperties.memoryTypes[i].propertyFlags & lazyProperties) == lazyProperties) {
+                memoryType = i;
+                lazilyAllocated = true;
+                break;
+            }
+        }
+        if (!lazilyAllocated) {
+            memoryType = findMemoryType(memRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        }
+
+        VkMemoryAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.allocationSize = memRequirements.size;
+        allocInfo.memoryTypeIndex = memoryType;
+
+        if (vkAllocateMemory(device_, &allocInfo, nullptr, &imageMemory) != VK_SUCCESS) {
+            throw std::runtime_error("failed to allocate image memory!");
+        }
+
+        if (vkBindImageMemory(device_, image, imageMemory, 0) != VK_SUCCESS) {
+            throw std::runtime_error("failed to bind image memory!");
+        }
+
+        return lazilyAllocated;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,134 @@
+#include "aurora_engine/core/aurora_instance_store.hpp"
+#include "aurora_engine/core/aurora_deletion_queue.hpp"
+#include "aurora_engine/profiling/aurora_profiler.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
+
+namespace aurora {
+
+    AuroraInstanceStore::AuroraInstanceStore(AuroraDevice& device, VkDeviceSize stride, uint32_t frameCount)
+        : device{device}, stride{stride}, frames(frameCount) {
+        assert(frameCount > 0 && frameCount <= 32 && "Pending frames are tracked in a 32-bit mask");
+        allFramesMask = frameCount == 32 ? UINT32_MAX : (1u << frameCount) - 1;
+    }
+
+    AuroraInstanceStore::~AuroraInstanceStore() {
+        for (auto& frame : frames) {
+            device.getDeletionQueue().freeBuffer(device.getDynamicVertexBufferPool(), frame.allocation);
+        }
+    }
+
+    void AuroraInstanceStore::clear() {
+        data.clear();
+        ranges.clear();
+        pendingRanges.clear();
+        instanceCount = 0;
+
+        for (auto& frame : frames) {
+            frame.needsFullUpload = true;
+        }
+    }
+
+    uint32_t AuroraInstanceStore::addRange(const void* instances, uint32_t count) {
+        size_t offset = data.size();
+        data.resize(offset + count * stride);
+        if (count > 0) {
+            std::memcpy(data.data() + offset, instances, count * stride);
+        }
+
+        ranges.push_back({instanceCount, count, 0});
+        instanceCount += count;
+
+        // Frame copies receive the new layout in full on their next upload
+        for (auto& frame : frames) {
+            frame.needsFullUpload = true;
+        }
+        return static_cast<uint32_t>(ranges.size() - 1);
+    }
+
+    bool AuroraInstanceStore::writeRange(uint32_t range, const void* instances, uint32_t count) {
+        assert(range < ranges.size() && "Instance range out of bounds");
+        Range& target = ranges[range];
+        if (target.count != count) {
+            return false;
+        }
+
+        if (count > 0) {
+            std::memcpy(data.data() + target.first * stride, instances, count * stride);
+            markPending(range);
+        }
+        return true;
+    }
+
+    void AuroraInstanceStore::clearRange(uint32_t range) {
+        assert(range < ranges.size() && "Instance range out of bounds");
+        Range& target = ranges[range];
+        if (target.count == 0) return;
+
+        std::memset(data.data() + target.first * stride, 0, target.count * stride);
+        markPending(range);
+    }
+
+    void AuroraInstanceStore::markPending(uint32_t range) {
+        if (ranges[range].pendingFrames == 0) {
+            pendingRanges.push_back(range);
+        }
+        ranges[range].pendingFrames = allFramesMask;
+    }
+
+    void AuroraInstanceStore::upload(uint32_t frameIndex) {
+        assert(frameIndex < frames.size() && "Frame index out of range");
+        FrameCopy& frame = frames[frameIndex];
+        const uint32_t frameBit = 1u << frameIndex;
+
+        if (frame.capacity < instanceCount) {
+            // Grow geometrically so a scene that keeps adding components does not reallocate every frame
+            uint32_t capacity = std::max(instanceCount, frame.capacity + frame.capacity / 2);
+            device.getDeletionQueue().freeBuffer(device.getDynamicVertexBufferPool(), frame.allocation);
+
+            frame.allocation = device.getDynamicVertexBufferPool().allocate(capacity * stride, 16);
+            if (!frame.allocation.isValid()) {
+                frame.capacity = 0;
+                throw std::runtime_error("failed to allocate persistent instance buffer!");
+            }
+            frame.capacity = capacity;
+            frame.needsFullUpload = true;
+        }
+
+        uint64_t instancesWritten = 0;
+        auto* mapped = static_cast<uint8_t*>(frame.allocation.mappedMemory);
+
+        if (frame.needsFullUpload) {
+            if (instanceCount > 0) {
+                std::memcpy(mapped, data.data(), instanceCount * stride);
+            }
+            instancesWritten = instanceCount;
+            frame.needsFullUpload = false;
+
+            for (uint32_t range : pendingRanges) {
+                ranges[range].pendingFrames &= ~frameBit;
+            }
+        } else {
+            for (uint32_t range : pendingRanges) {
+                Range& pending = ranges[range];
+                if (!(pending.pendingFrames & frameBit)) continue;
+
+                std::memcpy(mapped + pending.first * stride, data.data() + pending.first * stride, pending.count * stride);
+                instancesWritten += pending.count;
+                pending.pendingFrames &= ~frameBit;
+            }
+        }
+
+        pendingRanges.erase(std::remove_if(pendingRanges.begin(), pendingRanges.end(), [this](uint32_t range) {
+            return ranges[range].pendingFrames == 0;
+        }), pendingRanges.end());
+
+        if (instancesWritten > 0) {
+            AuroraProfiler::instance().incrementCounter("Instance Slots Written", instancesWritten);
+        }
+    }
+
+}
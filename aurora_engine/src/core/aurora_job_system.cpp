@@ -0,0 +1,241 @@
+#include "aurora_engine/core/aurora_job_system.hpp"
+#include "aurora_engine/profiling/aurora_profiler.hpp"
+#include "aurora_engine/utils/log.hpp"
+
+#include <algorithm>
+#include <string>
+
+namespace aurora {
+
+    namespace {
+        // Queue 0 is shared by every thread that is not a worker
+        thread_local uint32_t workerQueueIndex = 0;
+    }
+
+    AuroraJobSystem::AuroraJobSystem() {
+        // Jobs record profiler zones, so the profiler has to outlive the workers
+        AuroraProfiler::instance();
+
+        uint32_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+        uint32_t workerCount = hardwareThreads - 1;
+
+        queues.reserve(workerCount + 1);
+        for (uint32_t i = 0; i <= workerCount; ++i) {
+            queues.push_back(std::make_unique<WorkerQueue>());
+        }
+
+        workers.reserve(workerCount);
+        for (uint32_t i = 1; i <= workerCount; ++i) {
+            workers.emplace_back(&AuroraJobSystem::workerMain, this, i);
+        }
+
+        log::engine()->info("Job system started with {} workers", workerCount);
+    }
+
+    AuroraJobSystem::~AuroraJobSystem() {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping = true;
+        }
+        sleepCondition.notify_all();
+
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    AuroraJobSystem::JobHandle AuroraJobSystem::schedule(const char* name, JobFunction function, const std::vector<JobHandle>& dependencies) {
+        auto job = std::make_shared<Job>();
+        job->function = std::move(function);
+        job->zoneId = AuroraProfiler::instance().internZone(name);
+
+        for (const auto& dependency : dependencies) {
+            if (!dependency.job) continue;
+
+            std::lock_guard<std::mutex> lock(dependency.job->continuationMutex);
+            if (!dependency.job->finished.load(std::memory_order_acquire)) {
+                job->unfinishedDependencies.fetch_add(1, std::memory_order_relaxed);
+                dependency.job->continuations.push_back(job);
+            }
+        }
+
+        // Drops the registration guard; enqueues right away if every dependency already finished
+        if (job->unfinishedDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            enqueue(job);
+        }
+
+        return JobHandle{job};
+    }
+
+    void AuroraJobSystem::wait(const JobHandle& handle) {
+        uint32_t queueIndex = currentQueueIndex();
+
+        while (!handle.isDone()) {
+            if (auto job = findJob(queueIndex)) {
+                execute(job);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+
+        if (handle.job && handle.job->error) {
+            std::rethrow_exception(handle.job->error);
+        }
+    }
+
+    void AuroraJobSystem::waitAll(const std::vector<JobHandle>& handles) {
+        std::exception_ptr error;
+        for (const auto& handle : handles) {
+            try {
+                wait(handle);
+            } catch (...) {
+                if (!error) error = std::current_exception();
+            }
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    void AuroraJobSystem::parallelFor(const char* name, size_t count, size_t grainSize, const RangeFunction& function) {
+        if (count == 0) return;
+        grainSize = std::max<size_t>(grainSize, 1);
+
+        // The calling thread takes the first range itself instead of queueing it
+        std::vector<JobHandle> handles;
+        handles.reserve((count - 1) / grainSize);
+        for (size_t begin = grainSize; begin < count; begin += grainSize) {
+            size_t end = std::min(begin + grainSize, count);
+            handles.push_back(schedule(name, [&function, begin, end]() { function(begin, end); }));
+        }
+
+        std::exception_ptr error;
+        try {
+            AuroraProfiler::ProfileBlock zone{AuroraProfiler::instance().internZone(name)};
+            function(0, std::min(grainSize, count));
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        // Every range must finish before returning, they reference the caller's function
+        try {
+            waitAll(handles);
+        } catch (...) {
+            if (!error) error = std::current_exception();
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    void AuroraJobSystem::publishStatistics() {
+        auto& profiler = AuroraProfiler::instance();
+        profiler.setCounter("Job Queue Depth", maxQueueDepth.exchange(0, std::memory_order_relaxed));
+        profiler.setCounter("Job Steals", stealCount.exchange(0, std::memory_order_relaxed));
+        profiler.setCounter("Jobs Executed", executedCount.exchange(0, std::memory_order_relaxed));
+    }
+
+    void AuroraJobSystem::workerMain(uint32_t queueIndex) {
+        workerQueueIndex = queueIndex;
+        AuroraProfiler::instance().setThreadName(("Job Worker " + std::to_string(queueIndex)).c_str());
+
+        while (true) {
+            if (auto job = findJob(queueIndex)) {
+                execute(job);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            sleepCondition.wait(lock, [this]() { return stopping || queuedJobs.load(std::memory_order_acquire) > 0; });
+            if (stopping) {
+                return;
+            }
+        }
+    }
+
+    void AuroraJobSystem::enqueue(std::shared_ptr<Job> job) {
+        // Counted before it becomes visible so a concurrent pop can never take the count below zero
+        uint32_t depth = queuedJobs.fetch_add(1, std::memory_order_acq_rel) + 1;
+        uint32_t maxDepth = maxQueueDepth.load(std::memory_order_relaxed);
+        while (depth > maxDepth && !maxQueueDepth.compare_exchange_weak(maxDepth, depth, std::memory_order_relaxed)) {}
+
+        auto& queue = *queues[currentQueueIndex()];
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.jobs.push_back(std::move(job));
+        }
+
+        // Taking the lock orders the notify after a sleeping worker checked the queue count
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+        }
+        sleepCondition.notify_one();
+    }
+
+    std::shared_ptr<AuroraJobSystem::Job> AuroraJobSystem::popLocal(uint32_t queueIndex) {
+        auto& queue = *queues[queueIndex];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.jobs.empty()) return nullptr;
+
+        auto job = std::move(queue.jobs.back());
+        queue.jobs.pop_back();
+        queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+        return job;
+    }
+
+    std::shared_ptr<AuroraJobSystem::Job> AuroraJobSystem::steal(uint32_t queueIndex) {
+        for (size_t offset = 1; offset < queues.size(); ++offset) {
+            auto& queue = *queues[(queueIndex + offset) % queues.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.jobs.empty()) continue;
+
+            auto job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+            queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+            stealCount.fetch_add(1, std::memory_order_relaxed);
+            return job;
+        }
+        return nullptr;
+    }
+
+    std::shared_ptr<AuroraJobSystem::Job> AuroraJobSystem::findJob(uint32_t queueIndex) {
+        if (queuedJobs.load(std::memory_order_acquire) == 0) return nullptr;
+
+        if (auto job = popLocal(queueIndex)) {
+            return job;
+        }
+        return steal(queueIndex);
+    }
+
+    void AuroraJobSystem::execute(const std::shared_ptr<Job>& job) {
+        {
+            AuroraProfiler::ProfileBlock zone{job->zoneId};
+            try {
+                job->function();
+            } catch (...) {
+                job->error = std::current_exception();
+            }
+        }
+        executedCount.fetch_add(1, std::memory_order_relaxed);
+
+        std::vector<std::shared_ptr<Job>> continuations;
+        {
+            std::lock_guard<std::mutex> lock(job->continuationMutex);
+            job->finished.store(true, std::memory_order_release);
+            continuations.swap(job->continuations);
+        }
+
+        for (auto& continuation : continuations) {
+            if (continuation->unfinishedDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                enqueue(std::move(continuation));
+            }
+        }
+    }
+
+    uint32_t AuroraJobSystem::currentQueueIndex() const {
+        return workerQueueIndex;
+    }
+
+}
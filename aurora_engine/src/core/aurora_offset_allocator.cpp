@@ -0,0 +1,277 @@
+#include "aurora_engine/core/aurora_offset_allocator.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+namespace aurora {
+
+    AuroraFirstFitAllocator::AuroraFirstFitAllocator(VkDeviceSize size) {
+        freeMap.insert({0, size});
+    }
+
+    bool AuroraFirstFitAllocator::allocate(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize& outOffset, uint32_t& outBlockId) {
+        for (auto it = freeMap.begin(); it != freeMap.end(); ++it) {
+            VkDeviceSize currentOffset = it->first;
+            VkDeviceSize currentSize = it->second;
+
+            VkDeviceSize alignedOffset = (currentOffset + alignment - 1) & ~(alignment - 1);
+            VkDeviceSize padding = alignedOffset - currentOffset;
+
+            if (currentSize >= size + padding) {
+                outOffset = alignedOffset;
+                outBlockId = 0;
+                VkDeviceSize remainingSize = currentSize - (size + padding);
+
+                freeMap.erase(it);
+
+                if (padding > 0) {
+                    freeMap[currentOffset] = padding;
+                }
+
+                if (remainingSize > 0) {
+                    freeMap[outOffset + size] = remainingSize;
+                }
+
+                allocatedSize += size;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void AuroraFirstFitAllocator::free(VkDeviceSize offset, VkDeviceSize size, uint32_t /*blockId*/) {
+        auto next = freeMap.lower_bound(offset);
+        auto prev = (next == freeMap.begin()) ? freeMap.end() : std::prev(next);
+
+        bool mergedWithPrev = false;
+        if (prev != freeMap.end() && (prev->first + prev->second) == offset) {
+            prev->second += size;
+            mergedWithPrev = true;
+        }
+        if (next != freeMap.end() && (offset + size) == next->first) {
+            if (mergedWithPrev) {
+                prev->second += next->second;
+                freeMap.erase(next);
+            } else {
+                VkDeviceSize nextSize = next->second;
+                freeMap.erase(next);
+                freeMap[offset] = size + nextSize;
+            }
+        } else {
+            if (!mergedWithPrev) {
+                freeMap[offset] = size;
+            }
+        }
+
+        allocatedSize -= size;
+    }
+
+    AuroraTlsfAllocator::AuroraTlsfAllocator(VkDeviceSize size) {
+        for (auto& lists : freeLists) {
+            lists.fill(NO_BLOCK);
+        }
+
+        VkDeviceSize usableSize = size & ~(GRANULARITY - 1);
+        assert(usableSize / GRANULARITY < (VkDeviceSize{1} << 32) && "TLSF range too large");
+
+        if (usableSize > 0) {
+            insertFreeBlock(createBlock(0, usableSize));
+        }
+    }
+
+    void AuroraTlsfAllocator::mappingInsert(VkDeviceSize size, uint32_t& fl, uint32_t& sl) {
+        VkDeviceSize units = size / GRANULARITY;
+        if (units < SL_COUNT) {
+            fl = 0;
+            sl = static_cast<uint32_t>(units);
+        } else {
+            uint32_t msb = 63 - static_cast<uint32_t>(__builtin_clzll(units));
+            fl = msb - SL_BITS + 1;
+            sl = static_cast<uint32_t>(units >> (msb - SL_BITS)) - SL_COUNT;
+        }
+    }
+
+    void AuroraTlsfAllocator::mappingSearch(VkDeviceSize size, uint32_t& fl, uint32_t& sl) {
+        // Round up to the next size class so that any block found in it is large enough
+        VkDeviceSize units = size / GRANULARITY;
+        if (units >= SL_COUNT) {
+            uint32_t msb = 63 - static_cast<uint32_t>(__builtin_clzll(units));
+            units += (VkDeviceSize{1} << (msb - SL_BITS)) - 1;
+        }
+        mappingInsert(units * GRANULARITY, fl, sl);
+    }
+
+    uint32_t AuroraTlsfAllocator::findFreeBlock(uint32_t& fl, uint32_t& sl) const {
+        if (fl >= FL_COUNT) {
+            return NO_BLOCK;
+        }
+
+        uint32_t slMap = slBitmap[fl] & (~0u << sl);
+        if (slMap == 0) {
+            uint32_t flMap = (fl + 1 < FL_COUNT) ? flBitmap & (~0u << (fl + 1)) : 0;
+            if (flMap == 0) {
+                return NO_BLOCK;
+            }
+
+            fl = static_cast<uint32_t>(__builtin_ctz(flMap));
+            slMap = slBitmap[fl];
+        }
+
+        sl = static_cast<uint32_t>(__builtin_ctz(slMap));
+        return freeLists[fl][sl];
+    }
+
+    uint32_t AuroraTlsfAllocator::createBlock(VkDeviceSize offset, VkDeviceSize size) {
+        uint32_t index;
+        if (!unusedBlocks.empty()) {
+            index = unusedBlocks.back();
+            unusedBlocks.pop_back();
+        } else {
+            index = static_cast<uint32_t>(blocks.size());
+            blocks.emplace_back();
+        }
+
+        blocks[index] = Block{offset, size, NO_BLOCK, NO_BLOCK, NO_BLOCK, NO_BLOCK, false};
+        return index;
+    }
+
+    void AuroraTlsfAllocator::releaseBlock(uint32_t index) {
+        unusedBlocks.push_back(index);
+    }
+
+    void AuroraTlsfAllocator::insertFreeBlock(uint32_t index) {
+        uint32_t fl, sl;
+        mappingInsert(blocks[index].size, fl, sl);
+
+        uint32_t head = freeLists[fl][sl];
+        blocks[index].isFree = true;
+        blocks[index].prevFree = NO_BLOCK;
+        blocks[index].nextFree = head;
+        if (head != NO_BLOCK) {
+            blocks[head].prevFree = index;
+        }
+
+        freeLists[fl][sl] = index;
+        flBitmap |= 1u << fl;
+        slBitmap[fl] |= 1u << sl;
+    }
+
+    void AuroraTlsfAllocator::removeFreeBlock(uint32_t index) {
+        uint32_t fl, sl;
+        mappingInsert(blocks[index].size, fl, sl);
+
+        Block& block = blocks[index];
+        if (block.prevFree != NO_BLOCK) {
+            blocks[block.prevFree].nextFree = block.nextFree;
+        }
+        if (block.nextFree != NO_BLOCK) {
+            blocks[block.nextFree].prevFree = block.prevFree;
+        }
+
+        if (freeLists[fl][sl] == index) {
+            freeLists[fl][sl] = block.nextFree;
+            if (freeLists[fl][sl] == NO_BLOCK) {
+                slBitmap[fl] &= ~(1u << sl);
+                if (slBitmap[fl] == 0) {
+                    flBitmap &= ~(1u << fl);
+                }
+            }
+        }
+
+        block.isFree = false;
+        block.prevFree = NO_BLOCK;
+        block.nextFree = NO_BLOCK;
+    }
+
+    uint32_t AuroraTlsfAllocator::splitBlock(uint32_t index, VkDeviceSize size) {
+        VkDeviceSize remainderOffset = blocks[index].offset + size;
+        VkDeviceSize remainderSize = blocks[index].size - size;
+
+        uint32_t remainder = createBlock(remainderOffset, remainderSize);
+        uint32_t next = blocks[index].nextPhysical;
+
+        blocks[remainder].prevPhysical = index;
+        blocks[remainder].nextPhysical = next;
+        if (next != NO_BLOCK) {
+            blocks[next].prevPhysical = remainder;
+        }
+
+        blocks[index].nextPhysical = remainder;
+        blocks[index].size = size;
+        return remainder;
+    }
+
+    bool AuroraTlsfAllocator::allocate(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize& outOffset, uint32_t& outBlockId) {
+        VkDeviceSize blockSize = (std::max<VkDeviceSize>(size, 1) + GRANULARITY - 1) & ~(GRANULARITY - 1);
+
+        // Block offsets are always multiples of GRANULARITY, larger alignments need room for padding
+        VkDeviceSize searchSize = blockSize;
+        if (alignment > GRANULARITY) {
+            searchSize += alignment - GRANULARITY;
+        }
+
+        uint32_t fl, sl;
+        mappingSearch(searchSize, fl, sl);
+
+        uint32_t index = findFreeBlock(fl, sl);
+        if (index == NO_BLOCK) {
+            return false;
+        }
+
+        removeFreeBlock(index);
+
+        if (alignment > GRANULARITY) {
+            VkDeviceSize alignedOffset = (blocks[index].offset + alignment - 1) & ~(alignment - 1);
+            VkDeviceSize padding = alignedOffset - blocks[index].offset;
+            if (padding > 0) {
+                uint32_t front = index;
+                index = splitBlock(front, padding);
+                insertFreeBlock(front);
+            }
+        }
+
+        if (blocks[index].size > blockSize) {
+            insertFreeBlock(splitBlock(index, blockSize));
+        }
+
+        allocatedSize += blocks[index].size;
+        outOffset = blocks[index].offset;
+        outBlockId = index;
+        return true;
+    }
+
+    void AuroraTlsfAllocator::free(VkDeviceSize offset, VkDeviceSize /*size*/, uint32_t blockId) {
+        assert(blockId < blocks.size() && blocks[blockId].offset == offset && !blocks[blockId].isFree && "Invalid TLSF block");
+        (void)offset;
+
+        uint32_t index = blockId;
+        allocatedSize -= blocks[index].size;
+
+        uint32_t prev = blocks[index].prevPhysical;
+        if (prev != NO_BLOCK && blocks[prev].isFree) {
+            removeFreeBlock(prev);
+            blocks[prev].size += blocks[index].size;
+            blocks[prev].nextPhysical = blocks[index].nextPhysical;
+            if (blocks[index].nextPhysical != NO_BLOCK) {
+                blocks[blocks[index].nextPhysical].prevPhysical = prev;
+            }
+            releaseBlock(index);
+            index = prev;
+        }
+
+        uint32_t next = blocks[index].nextPhysical;
+        if (next != NO_BLOCK && blocks[next].isFree) {
+            removeFreeBlock(next);
+            blocks[index].size += blocks[next].size;
+            blocks[index].nextPhysical = blocks[next].nextPhysical;
+            if (blocks[next].nextPhysical != NO_BLOCK) {
+                blocks[blocks[next].nextPhysical].prevPhysical = index;
+            }
+            releaseBlock(next);
+        }
+
+        insertFreeBlock(index);
+    }
+
+}
@@ -0,0 +1,213 @@
+#include "aurora_engine/core/aurora_pipeline_cache.hpp"
+#include "aurora_engine/core/aurora_device.hpp"
+#include "aurora_engine/profiling/aurora_profiler.hpp"
+#include "aurora_engine/utils/log.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace aurora {
+    namespace {
+        constexpr char CACHE_MAGIC[8] = {'A', 'U', 'R', 'P', 'S', 'O', 'C', '\0'};
+        constexpr uint32_t CACHE_VERSION = 1;
+
+        // Vulkan's own header only identifies the device, so the driver version is checked here too
+        struct CacheHeader {
+            char magic[8];
+            uint32_t version;
+            uint32_t vendorId;
+            uint32_t deviceId;
+            uint32_t driverVersion;
+            uint8_t pipelineCacheUuid[VK_UUID_SIZE];
+            uint64_t dataSize;
+            uint64_t dataHash;
+        };
+
+        uint64_t fnv1a(const void* data, size_t size) {
+            const auto* bytes = static_cast<const uint8_t*>(data);
+            uint64_t hash = 14695981039346656037ull;
+            for (size_t i = 0; i < size; ++i) {
+                hash ^= bytes[i];
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+    }
+
+    AuroraPipelineCache::AuroraPipelineCache(AuroraDevice& device, std::string cachePath)
+        : device{device}, cachePath{std::move(cachePath)} {
+        AURORA_PROFILE("Pipeline Cache Load");
+
+        std::vector<char> initialData;
+        loadedFromDisk = loadCacheData(initialData);
+
+        VkPipelineCacheCreateInfo createInfo{};
+        createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        createInfo.initialDataSize = initialData.size();
+        createInfo.pInitialData = initialData.data();
+
+        if (vkCreatePipelineCache(device.device(), &createInfo, nullptr, &pipelineCache) != VK_SUCCESS) {
+            // Drivers may still reject data that passed our checks; an empty cache always works
+            createInfo.initialDataSize = 0;
+            createInfo.pInitialData = nullptr;
+            loadedFromDisk = false;
+            if (vkCreatePipelineCache(device.device(), &createInfo, nullptr, &pipelineCache) != VK_SUCCESS) {
+                throw std::runtime_error("Failed to create pipeline cache");
+            }
+        }
+
+        savedSize = loadedFromDisk ? initialData.size() : 0;
+        if (loadedFromDisk) {
+            log::engine()->info("Loaded pipeline cache {} ({} KB)", this->cachePath, initialData.size() / 1024);
+        }
+    }
+
+    AuroraPipelineCache::~AuroraPipelineCache() {
+        save();
+
+        for (const auto& [path, shaderModule] : shaderModules) {
+            vkDestroyShaderModule(device.device(), shaderModule, nullptr);
+        }
+        vkDestroyPipelineCache(device.device(), pipelineCache, nullptr);
+    }
+
+    bool AuroraPipelineCache::loadCacheData(std::vector<char>& data) const {
+        std::ifstream file{cachePath, std::ios::ate | std::ios::binary};
+        if (!file.is_open()) {
+            return false;
+        }
+
+        size_t fileSize = static_cast<size_t>(file.tellg());
+        if (fileSize < sizeof(CacheHeader)) {
+            log::engine()->info("Pipeline cache {} is truncated, starting empty", cachePath);
+            return false;
+        }
+
+        CacheHeader header;
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+        const VkPhysicalDeviceProperties& properties = device.properties;
+        bool valid = memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) == 0 &&
+                     header.version == CACHE_VERSION &&
+                     header.vendorId == properties.vendorID &&
+                     header.deviceId == properties.deviceID &&
+                     header.driverVersion == properties.driverVersion &&
+                     memcmp(header.pipelineCacheUuid, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0 &&
+                     header.dataSize == fileSize - sizeof(CacheHeader);
+
+        if (!valid) {
+            log::engine()->info("Pipeline cache {} was written for another device or driver, starting empty", cachePath);
+            return false;
+        }
+
+        data.resize(header.dataSize);
+        file.read(data.data(), static_cast<std::streamsize>(data.size()));
+        if (!file || fnv1a(data.data(), data.size()) != header.dataHash) {
+            log::engine()->warn("Pipeline cache {} is corrupt, starting empty", cachePath);
+            data.clear();
+            return false;
+        }
+        return true;
+    }
+
+    void AuroraPipelineCache::save() {
+        size_t dataSize = 0;
+        if (vkGetPipelineCacheData(device.device(), pipelineCache, &dataSize, nullptr) != VK_SUCCESS) {
+            log::engine()->warn("Failed to query pipeline cache size");
+            return;
+        }
+
+        // Entries are only ever added, an unchanged size means nothing new to write
+        if (dataSize == savedSize) {
+            return;
+        }
+
+        std::vector<char> data(dataSize);
+        if (vkGetPipelineCacheData(device.device(), pipelineCache, &dataSize, data.data()) != VK_SUCCESS) {
+            log::engine()->warn("Failed to read pipeline cache data");
+            return;
+        }
+        data.resize(dataSize);
+
+        const VkPhysicalDeviceProperties& properties = device.properties;
+        CacheHeader header{};
+        memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+        header.version = CACHE_VERSION;
+        header.vendorId = properties.vendorID;
+        header.deviceId = properties.deviceID;
+        header.driverVersion = properties.driverVersion;
+        memcpy(header.pipelineCacheUuid, properties.pipelineCacheUUID, VK_UUID_SIZE);
+        header.dataSize = data.size();
+        header.dataHash = fnv1a(data.data(), data.size());
+
+        // Written to a temporary file and renamed so a crash never leaves a truncated cache behind
+        std::string tempPath = cachePath + ".tmp";
+        std::ofstream file{tempPath, std::ios::binary | std::ios::trunc};
+        if (!file.is_open()) {
+            log::engine()->warn("Failed to open pipeline cache {} for writing", tempPath);
+            return;
+        }
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(data.data(), static_cast<std::streamsize>(data.size()));
+        file.close();
+
+        if (!file || std::rename(tempPath.c_str(), cachePath.c_str()) != 0) {
+            log::engine()->warn("Failed to write pipeline cache {}", cachePath);
+            std::remove(tempPath.c_str());
+            return;
+        }
+
+        savedSize = data.size();
+        log::engine()->info("Wrote pipeline cache {} ({} KB)", cachePath, data.size() / 1024);
+    }
+
+    VkShaderModule AuroraPipelineCache::getShaderModule(const std::string& filePath) {
+        // Held while loading so two pipelines sharing a shader never read it twice
+        std::lock_guard<std::mutex> lock{shaderModuleMutex};
+
+        auto it = shaderModules.find(filePath);
+        if (it != shaderModules.end()) {
+            return it->second;
+        }
+
+        std::vector<char> code = readFile(filePath);
+
+        VkShaderModuleCreateInfo createInfo{};
+        createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        createInfo.codeSize = code.size();
+        createInfo.pCode = reinterpret_cast<const uint32_t*>(code.data());
+
+        VkShaderModule shaderModule;
+        if (vkCreateShaderModule(device.device(), &createInfo, nullptr, &shaderModule) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create shader module: " + filePath);
+        }
+
+        shaderModules.emplace(filePath, shaderModule);
+        return shaderModule;
+    }
+
+    size_t AuroraPipelineCache::getShaderModuleCount() const {
+        std::lock_guard<std::mutex> lock{shaderModuleMutex};
+        return shaderModules.size();
+    }
+
+    std::vector<char> AuroraPipelineCache::readFile(const std::string& filePath) {
+        std::ifstream file{filePath, std::ios::ate | std::ios::binary};
+
+        if (!file.is_open()) {
+            throw std::runtime_error("Failed to open file: " + filePath);
+        }
+
+        size_t fileSize = static_cast<size_t>(file.tellg());
+        std::vector<char> buffer(fileSize);
+
+        file.seekg(0);
+        file.read(buffer.data(), fileSize);
+
+        return buffer;
+    }
+}
@@ -1,5 +1,9 @@
 #include "aurora_engine/core/aurora_renderer.hpp"
+#include "aurora_engine/core/aurora_upload_queue.hpp"
+#include "aurora_engine/core/aurora_deletion_queue.hpp"
+#include "aurora_engine/core/aurora_job_system.hpp"
 
+#include <algorithm>
 #include <stdexcept>
 #include <array>
 #include "aurora_engine/utils/log.hpp"
@@ -12,6 +16,11 @@ namespace aurora {
         isFrameStarted = false;
         recreateSwapChain();
         createCommandBuffers();
+        gpuProfiler = std::make_unique<AuroraGpuProfiler>(auroraDevice, AuroraSwapChain::MAX_FRAMES_IN_FLIGHT);
+
+        uint32_t recordingThreads = std::clamp(AuroraJobSystem::instance().getThreadCount(), 1u, MAX_RECORDING_THREADS);
+        secondaryCommandBuffers = std::make_unique<AuroraSecondaryCommandBuffers>(
+            auroraDevice, recordingThreads, AuroraSwapChain::MAX_FRAMES_IN_FLIGHT);
     }
 
     AuroraRenderer::~AuroraRenderer() {
@@ -25,8 +34,6 @@ namespace aurora {
             glfwWaitEvents();
         }
 
-        vkDeviceWaitIdle(auroraDevice.device());
-        
         if (auroraSwapChain == nullptr) {
             auroraSwapChain = std::make_unique<AuroraSwapChain>(auroraDevice, extent);
         } else {
@@ -36,6 +43,9 @@ namespace aurora {
             if (!oldSwapChain->compareSwapFormats(*auroraSwapChain.get())) {
                 throw std::runtime_error("Swap chain image(or depth) format has changed");
             }
+
+            // Frames still in flight may reference the old images and framebuffers
+            auroraDevice.getDeletionQueue().push([oldSwapChain]() mutable { oldSwapChain.reset(); });
         }
     }
 
@@ -63,6 +73,11 @@ namespace aurora {
     }
     VkCommandBuffer AuroraRenderer::beginFrame(){
         assert(!isFrameStarted && "Frame already in progress");
+
+        if (swapChainRecreationRequested) {
+            swapChainRecreationRequested = false;
+            recreateSwapChain();
+        }
         
         auto result = auroraSwapChain->acquireNextImage(&currentImageIndex);
 
@@ -78,6 +93,9 @@ namespace aurora {
 
         isFrameStarted = true;
 
+        auroraDevice.getDeletionQueue().beginFrame(static_cast<uint32_t>(currentFrameIndex));
+        secondaryCommandBuffers->beginFrame(static_cast<uint32_t>(currentFrameIndex));
+
         auto commandBuffer = getCurrentCommandBuffer();
         VkCommandBufferBeginInfo beginInfo{};
         beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
@@ -86,6 +104,8 @@ namespace aurora {
             throw std::runtime_error("Failed to begin recording command buffer");
         }
 
+        gpuProfiler->beginFrame(commandBuffer, static_cast<uint32_t>(currentFrameIndex));
+
         return commandBuffer;
     }
 
@@ -97,6 +117,8 @@ namespace aurora {
             throw std::runtime_error("Failed to record command buffer");
         }
 
+        auroraDevice.getUploadQueue().submit();
+
         auto result = auroraSwapChain->submitCommandBuffers(&commandBuffer, &currentImageIndex);
 
         if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || auroraWindow.wasWindowResized()) {
@@ -111,7 +133,7 @@ namespace aurora {
         currentFrameIndex = (currentFrameIndex + 1) % AuroraSwapChain::MAX_FRAMES_IN_FLIGHT;
     }
 
-    void AuroraRenderer::beginSwapChainRenderPass(VkCommandBuffer commandBuffer){
+    void AuroraRenderer::beginSwapChainRenderPass(VkCommandBuffer commandBuffer, VkSubpassContents contents){
         assert(isFrameStarted && "Cannot begin swap chain render pass because no frame is in progress");
         assert(commandBuffer == getCurrentCommandBuffer() && "Command buffer is not the current command buffer");
 
@@ -121,7 +143,7 @@ namespace aurora {
         renderPassInfo.framebuffer = auroraSwapChain->getFrameBuffer(currentImageIndex);
 
         renderPassInfo.renderArea.offset = {0, 0};
-        renderPassInfo.renderArea.extent = auroraSwapChain->getSwapChainExtent();
+        renderPassInfo.renderArea.extent = auroraSwapChain->getRenderExtent();
 
         std::array<VkClearValue, 3> clearValues{};
         clearValues[0].color = {{backgroundColor.r, backgroundColor.g, backgroundColor.b, backgroundColor.a}};
@@ -130,24 +152,63 @@ namespace aurora {
         renderPassInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
         renderPassInfo.pClearValues = clearValues.data();
 
-        vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+        renderPassZone = gpuProfiler->beginZone(commandBuffer, AuroraGpuProfiler::RENDER_PASS_ZONE);
+        vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, contents);
+
+        // Secondary command buffers set their own dynamic state, the primary may only execute them
+        if (contents == VK_SUBPASS_CONTENTS_INLINE) {
+            setViewportAndScissor(commandBuffer);
+        }
+    }
 
+    void AuroraRenderer::setViewportAndScissor(VkCommandBuffer commandBuffer) {
         VkViewport viewport{};
         viewport.x = 0.0f;
         viewport.y = 0.0f;
-        viewport.width = static_cast<float>(auroraSwapChain->getSwapChainExtent().width);
-        viewport.height = static_cast<float>(auroraSwapChain->getSwapChainExtent().height);
+        viewport.width = static_cast<float>(auroraSwapChain->getRenderExtent().width);
+        viewport.height = static_cast<float>(auroraSwapChain->getRenderExtent().height);
         viewport.minDepth = 0.0f;
         viewport.maxDepth = 1.0f;
-        VkRect2D scissor{{0, 0}, auroraSwapChain->getSwapChainExtent()};
+        VkRect2D scissor{{0, 0}, auroraSwapChain->getRenderExtent()};
         vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
         vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
     }
 
+    VkCommandBuffer AuroraRenderer::beginSecondaryCommandBuffer(uint32_t threadIndex) {
+        assert(isFrameStarted && "Cannot begin a secondary command buffer because no frame is in progress");
+
+        VkCommandBufferInheritanceInfo inheritanceInfo{};
+        inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        inheritanceInfo.renderPass = auroraSwapChain->getRenderPass();
+        inheritanceInfo.subpass = 0;
+        inheritanceInfo.framebuffer = auroraSwapChain->getFrameBuffer(currentImageIndex);
+
+        VkCommandBuffer commandBuffer = secondaryCommandBuffers->begin(threadIndex, inheritanceInfo);
+        setViewportAndScissor(commandBuffer);
+        return commandBuffer;
+    }
+
+    void AuroraRenderer::endSecondaryCommandBuffer(VkCommandBuffer commandBuffer) {
+        if (vkEndCommandBuffer(commandBuffer) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to record secondary command buffer");
+        }
+    }
+
+    void AuroraRenderer::executeSecondaryCommandBuffers(VkCommandBuffer commandBuffer, const std::vector<VkCommandBuffer>& secondaryBuffers) {
+        assert(commandBuffer == getCurrentCommandBuffer() && "Command buffer is not the current command buffer");
+        if (secondaryBuffers.empty()) return;
+
+        vkCmdExecuteCommands(commandBuffer, static_cast<uint32_t>(secondaryBuffers.size()), secondaryBuffers.data());
+    }
+
     void AuroraRenderer::endSwapChainRenderPass(VkCommandBuffer commandBuffer){
         assert(isFrameStarted && "Cannot end swap chain render pass because no frame is in progress");
         assert(commandBuffer == getCurrentCommandBuffer() && "Command buffer is not the current command buffer");
 
         vkCmdEndRenderPass(commandBuffer);
+        gpuProfiler->endZone(commandBuffer, renderPassZone);
+        renderPassZone = AuroraGpuProfiler::INVALID_ZONE;
+
+        auroraSwapChain->recordUpscale(commandBuffer, currentImageIndex);
     }
 }
\ No newline at end of file
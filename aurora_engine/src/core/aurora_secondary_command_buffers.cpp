@@ -0,0 +1,86 @@
+#include "aurora_engine/core/aurora_secondary_command_buffers.hpp"
+#include "aurora_engine/core/aurora_deletion_queue.hpp"
+#include "aurora_engine/utils/log.hpp"
+
+#include <cassert>
+#include <stdexcept>
+
+namespace aurora {
+
+    AuroraSecondaryCommandBuffers::AuroraSecondaryCommandBuffers(AuroraDevice& device, uint32_t threadCount, uint32_t frameCount)
+        : device{device}, threadCount{threadCount}, frames(frameCount) {
+        assert(threadCount > 0 && "At least one recording thread is required");
+
+        VkCommandPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.queueFamilyIndex = device.findPhysicalQueueFamilies().graphicsFamily;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
+        for (auto& pools : frames) {
+            pools.resize(threadCount);
+            for (auto& pool : pools) {
+                if (vkCreateCommandPool(device.device(), &poolInfo, nullptr, &pool.commandPool) != VK_SUCCESS) {
+                    throw std::runtime_error("failed to create secondary command pool!");
+                }
+            }
+        }
+
+        log::engine()->debug("Created secondary command pools for {} threads and {} frames", threadCount, frameCount);
+    }
+
+    AuroraSecondaryCommandBuffers::~AuroraSecondaryCommandBuffers() {
+        VkDevice vkDevice = device.device();
+        for (auto& pools : frames) {
+            for (auto& pool : pools) {
+                VkCommandPool commandPool = pool.commandPool;
+                device.getDeletionQueue().push([vkDevice, commandPool]() { vkDestroyCommandPool(vkDevice, commandPool, nullptr); });
+            }
+        }
+    }
+
+    void AuroraSecondaryCommandBuffers::beginFrame(uint32_t frameIndex) {
+        assert(frameIndex < frames.size() && "Frame index out of range");
+        currentFrame = frameIndex;
+
+        // The renderer has waited on this slot's fence, so none of its buffers are still pending
+        for (auto& pool : frames[frameIndex]) {
+            if (pool.used == 0) continue;
+
+            vkResetCommandPool(device.device(), pool.commandPool, 0);
+            pool.used = 0;
+        }
+    }
+
+    VkCommandBuffer AuroraSecondaryCommandBuffers::begin(uint32_t threadIndex, const VkCommandBufferInheritanceInfo& inheritanceInfo) {
+        assert(threadIndex < threadCount && "Thread index out of range");
+        auto& pool = frames[currentFrame][threadIndex];
+
+        if (pool.used == pool.commandBuffers.size()) {
+            VkCommandBufferAllocateInfo allocInfo{};
+            allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+            allocInfo.commandPool = pool.commandPool;
+            allocInfo.commandBufferCount = 1;
+
+            VkCommandBuffer commandBuffer;
+            if (vkAllocateCommandBuffers(device.device(), &allocInfo, &commandBuffer) != VK_SUCCESS) {
+                throw std::runtime_error("failed to allocate secondary command buffer!");
+            }
+            pool.commandBuffers.push_back(commandBuffer);
+        }
+
+        VkCommandBuffer commandBuffer = pool.commandBuffers[pool.used++];
+
+        VkCommandBufferBeginInfo beginInfo{};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT | VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+        if (vkBeginCommandBuffer(commandBuffer, &beginInfo) != VK_SUCCESS) {
+            throw std::runtime_error("failed to begin secondary command buffer!");
+        }
+
+        return commandBuffer;
+    }
+
+}
@@ -1,5 +1,6 @@
 #include "aurora_engine/core/aurora_swap_chain.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cstdlib>
 #include <cstring>
@@ -26,9 +27,22 @@ namespace aurora {
         createImageViews();
         createColorResources();
         createDepthResources();
+        createSceneResources();
         createRenderPass();
         createFramebuffers();
         createSyncObjects();
+
+        log::engine()->debug("Swap chain {}x{}, rendering at {}x{} with {}x MSAA, {:.1f} MB of attachments",
+            swapChainExtent.width, swapChainExtent.height, renderExtent.width, renderExtent.height,
+            static_cast<int>(device.msaaSamples), static_cast<double>(attachmentMemorySize) / (1024.0 * 1024.0));
+
+        // Allocating the transient pair per swap chain image would cost one extra pair per image
+        if (oldSwapChain == nullptr) {
+            double transientMb = static_cast<double>(transientMemorySize) / (1024.0 * 1024.0);
+            log::engine()->info("Shared transient attachments: {:.1f} MB{}, {:.1f} MB saved over {} swap chain images",
+                transientMb, transientLazilyAllocated ? " (lazily allocated)" : "",
+                transientMb * static_cast<double>(imageCount() - 1), imageCount());
+        }
     }
 
     AuroraSwapChain::~AuroraSwapChain() {
@@ -43,16 +57,20 @@ namespace aurora {
         }
 
         
-        for (size_t i = 0; i < colorImages.size(); i++) {
-            vkDestroyImageView(device.device(), colorImageViews[i], nullptr);
-            vkDestroyImage(device.device(), colorImages[i], nullptr);
-            vkFreeMemory(device.device(), colorImageMemorys[i], nullptr);
+        if (colorImage != VK_NULL_HANDLE) {
+            vkDestroyImageView(device.device(), colorImageView, nullptr);
+            vkDestroyImage(device.device(), colorImage, nullptr);
+            vkFreeMemory(device.device(), colorImageMemory, nullptr);
         }
 
-        for (size_t i = 0; i < depthImages.size(); i++) {
-            vkDestroyImageView(device.device(), depthImageViews[i], nullptr);
-            vkDestroyImage(device.device(), depthImages[i], nullptr);
-            vkFreeMemory(device.device(), depthImageMemorys[i], nullptr);
+        vkDestroyImageView(device.device(), depthImageView, nullptr);
+        vkDestroyImage(device.device(), depthImage, nullptr);
+        vkFreeMemory(device.device(), depthImageMemory, nullptr);
+
+        for (size_t i = 0; i < sceneImages.size(); i++) {
+            vkDestroyImageView(device.device(), sceneImageViews[i], nullptr);
+            vkDestroyImage(device.device(), sceneImages[i], nullptr);
+            vkFreeMemory(device.device(), sceneImageMemorys[i], nullptr);
         }
 
         for (auto framebuffer : swapChainFramebuffers) {
@@ -67,7 +85,11 @@ namespace aurora {
 
         for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
             vkDestroySemaphore(device.device(), imageAvailableSemaphores[i], nullptr);
-            vkDestroyFence(device.device(), inFlightFences[i], nullptr);
+        }
+
+        // Fences are handed over to the replacement swap chain on recreation
+        for (auto fence : inFlightFences) {
+            vkDestroyFence(device.device(), fence, nullptr);
         }
     }
 
@@ -95,7 +117,9 @@ namespace aurora {
         submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 
         VkSemaphore waitSemaphores[] = {imageAvailableSemaphores[currentFrame]};
-        VkPipelineStageFlags waitStages[] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
+        // With upscaling the swap chain image is first written by the blit, not the render pass
+        VkPipelineStageFlags waitStages[] = {
+            upscaling ? VK_PIPELINE_STAGE_TRANSFER_BIT : VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
         submitInfo.waitSemaphoreCount = 1;
         submitInfo.pWaitSemaphores = waitSemaphores;
         submitInfo.pWaitDstStageMask = waitStages;
@@ -144,6 +168,19 @@ namespace aurora {
         VkPresentModeKHR presentMode = chooseSwapPresentMode(swapChainSupport.presentModes);
         VkExtent2D extent = chooseSwapExtent(swapChainSupport.capabilities);
 
+        float renderScale = device.getRenderQuality().renderScale;
+        renderExtent = extent;
+        upscaling = false;
+        if (renderScale < 1.0f) {
+            if (supportsUpscale(swapChainSupport, surfaceFormat.format)) {
+                renderExtent.width = std::max(1u, static_cast<uint32_t>(static_cast<float>(extent.width) * renderScale));
+                renderExtent.height = std::max(1u, static_cast<uint32_t>(static_cast<float>(extent.height) * renderScale));
+                upscaling = renderExtent.width != extent.width || renderExtent.height != extent.height;
+            } else {
+                log::engine()->warn("Swap chain images cannot be blit targets, rendering at full resolution");
+            }
+        }
+
         uint32_t imageCount = swapChainSupport.capabilities.minImageCount + 1;
         if (swapChainSupport.capabilities.maxImageCount > 0 && imageCount > swapChainSupport.capabilities.maxImageCount) {
             imageCount = swapChainSupport.capabilities.maxImageCount;
@@ -159,6 +196,9 @@ namespace aurora {
         createInfo.imageExtent = extent;
         createInfo.imageArrayLayers = 1;
         createInfo.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+        if (upscaling) {
+            createInfo.imageUsage |= VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+        }
 
         QueueFamilyIndices indices = device.findPhysicalQueueFamilies();
         uint32_t queueFamilyIndices[] = {indices.graphicsFamily, indices.presentFamily};
@@ -214,60 +254,164 @@ namespace aurora {
     }
 
     void AuroraSwapChain::createColorResources() {
-        VkFormat colorFormat = swapChainImageFormat;
-        VkExtent2D swapChainExtent = getSwapChainExtent();
+        // Without MSAA the scene is rendered straight into the swap chain (or scene) image
+        if (device.msaaSamples == VK_SAMPLE_COUNT_1_BIT) {
+            return;
+        }
+
+        VkImageCreateInfo imageInfo{};
+        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        imageInfo.imageType = VK_IMAGE_TYPE_2D;
+        imageInfo.extent.width = renderExtent.width;
+        imageInfo.extent.height = renderExtent.height;
+        imageInfo.extent.depth = 1;
+        imageInfo.mipLevels = 1;
+        imageInfo.arrayLayers = 1;
+        imageInfo.format = swapChainImageFormat;
+        imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        imageInfo.usage = VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+        imageInfo.samples = device.msaaSamples;
+        imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        imageInfo.flags = 0;
+
+        createTransientAttachmentImage(imageInfo, VK_IMAGE_ASPECT_COLOR_BIT, colorImage, colorImageMemory, colorImageView);
+    }
+
+    void AuroraSwapChain::createSceneResources() {
+        if (!upscaling) {
+            return;
+        }
 
-        colorImages.resize(imageCount());
-        colorImageMemorys.resize(imageCount());
-        colorImageViews.resize(imageCount());
+        sceneImages.resize(imageCount());
+        sceneImageMemorys.resize(imageCount());
+        sceneImageViews.resize(imageCount());
 
-        for (size_t i = 0; i < colorImages.size(); i++) {
+        for (size_t i = 0; i < sceneImages.size(); i++) {
             VkImageCreateInfo imageInfo{};
             imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
             imageInfo.imageType = VK_IMAGE_TYPE_2D;
-            imageInfo.extent.width = swapChainExtent.width;
-            imageInfo.extent.height = swapChainExtent.height;
+            imageInfo.extent.width = renderExtent.width;
+            imageInfo.extent.height = renderExtent.height;
             imageInfo.extent.depth = 1;
             imageInfo.mipLevels = 1;
             imageInfo.arrayLayers = 1;
-            imageInfo.format = colorFormat;
+            imageInfo.format = swapChainImageFormat;
             imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
             imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-            imageInfo.usage = VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
-            imageInfo.samples = device.msaaSamples;
+            imageInfo.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+            imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
             imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
             imageInfo.flags = 0;
 
-            device.createImageWithInfo(imageInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, colorImages[i], colorImageMemorys[i]);
+            createAttachmentImage(imageInfo, VK_IMAGE_ASPECT_COLOR_BIT, sceneImages[i], sceneImageMemorys[i], sceneImageViews[i]);
+        }
+    }
 
-            VkImageViewCreateInfo viewInfo{};
-            viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
-            viewInfo.image = colorImages[i];
-            viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
-            viewInfo.format = colorFormat;
-            viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-            viewInfo.subresourceRange.baseMipLevel = 0;
-            viewInfo.subresourceRange.levelCount = 1;
-            viewInfo.subresourceRange.baseArrayLayer = 0;
-            viewInfo.subresourceRange.layerCount = 1;
+    void AuroraSwapChain::createAttachmentImage(const VkImageCreateInfo &imageInfo, VkImageAspectFlags aspectMask, VkImage &image, VkDeviceMemory &imageMemory, VkImageView &imageView) {
+        device.createImageWithInfo(imageInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, image, imageMemory);
 
-            if (vkCreateImageView(device.device(), &viewInfo, nullptr, &colorImageViews[i]) != VK_SUCCESS) {
-                throw std::runtime_error("failed to create MSAA color image view!");
-            }
+        VkMemoryRequirements memRequirements;
+        vkGetImageMemoryRequirements(device.device(), image, &memRequirements);
+        attachmentMemorySize += memRequirements.size;
+
+        createImageView(image, imageInfo.format, aspectMask, imageView);
+    }
+
+    void AuroraSwapChain::createTransientAttachmentImage(const VkImageCreateInfo &imageInfo, VkImageAspectFlags aspectMask, VkImage &image, VkDeviceMemory &imageMemory, VkImageView &imageView) {
+        transientLazilyAllocated &= device.createTransientImage(imageInfo, image, imageMemory);
+
+        VkMemoryRequirements memRequirements;
+        vkGetImageMemoryRequirements(device.device(), image, &memRequirements);
+        attachmentMemorySize += memRequirements.size;
+        transientMemorySize += memRequirements.size;
+
+        createImageView(image, imageInfo.format, aspectMask, imageView);
+    }
+
+    void AuroraSwapChain::createImageView(VkImage image, VkFormat format, VkImageAspectFlags aspectMask, VkImageView &imageView) {
+        VkImageViewCreateInfo viewInfo{};
+        viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        viewInfo.image = image;
+        viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        viewInfo.format = format;
+        viewInfo.subresourceRange.aspectMask = aspectMask;
+        viewInfo.subresourceRange.baseMipLevel = 0;
+        viewInfo.subresourceRange.levelCount = 1;
+        viewInfo.subresourceRange.baseArrayLayer = 0;
+        viewInfo.subresourceRange.layerCount = 1;
+
+        if (vkCreateImageView(device.device(), &viewInfo, nullptr, &imageView) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create attachment image view!");
         }
     }
 
+    bool AuroraSwapChain::supportsUpscale(const SwapChainSupportDetails &swapChainSupport, VkFormat format) {
+        if ((swapChainSupport.capabilities.supportedUsageFlags & VK_IMAGE_USAGE_TRANSFER_DST_BIT) == 0) {
+            return false;
+        }
+
+        VkFormatFeatureFlags required =
+            VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT | VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+        return (device.getFormatProperties(format).optimalTilingFeatures & required) == required;
+    }
+
+    void AuroraSwapChain::recordUpscale(VkCommandBuffer commandBuffer, uint32_t imageIndex) {
+        if (!upscaling) {
+            return;
+        }
+
+        VkImageMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = swapChainImages[imageIndex];
+        barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        barrier.subresourceRange.baseMipLevel = 0;
+        barrier.subresourceRange.levelCount = 1;
+        barrier.subresourceRange.baseArrayLayer = 0;
+        barrier.subresourceRange.layerCount = 1;
+
+        barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+            0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+        VkImageBlit blit{};
+        blit.srcSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+        blit.srcOffsets[1] = {static_cast<int32_t>(renderExtent.width), static_cast<int32_t>(renderExtent.height), 1};
+        blit.dstSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+        blit.dstOffsets[1] = {static_cast<int32_t>(swapChainExtent.width), static_cast<int32_t>(swapChainExtent.height), 1};
+
+        vkCmdBlitImage(commandBuffer,
+            sceneImages[imageIndex], VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            swapChainImages[imageIndex], VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            1, &blit, VK_FILTER_LINEAR);
+
+        barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = 0;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+            0, 0, nullptr, 0, nullptr, 1, &barrier);
+    }
+
     void AuroraSwapChain::createRenderPass() {
-        
+        bool multisampled = device.msaaSamples != VK_SAMPLE_COUNT_1_BIT;
+        VkImageLayout outputLayout = upscaling ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+
+        // Without MSAA the color attachment is the output image itself and nothing is resolved
         VkAttachmentDescription colorAttachment{};
         colorAttachment.format = getSwapChainImageFormat();
         colorAttachment.samples = device.msaaSamples;
         colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
-        colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        colorAttachment.storeOp = multisampled ? VK_ATTACHMENT_STORE_OP_DONT_CARE : VK_ATTACHMENT_STORE_OP_STORE;
         colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
         colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
         colorAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-        colorAttachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        colorAttachment.finalLayout = multisampled ? VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL : outputLayout;
 
         VkAttachmentReference colorAttachmentRef{};
         colorAttachmentRef.attachment = 0;
@@ -297,7 +441,7 @@ namespace aurora {
         colorAttachmentResolve.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
         colorAttachmentResolve.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
         colorAttachmentResolve.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-        colorAttachmentResolve.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        colorAttachmentResolve.finalLayout = outputLayout;
 
         VkAttachmentReference colorAttachmentResolveRef{};
         colorAttachmentResolveRef.attachment = 2;
@@ -308,28 +452,44 @@ namespace aurora {
         subpass.colorAttachmentCount = 1;
         subpass.pColorAttachments = &colorAttachmentRef;
         subpass.pDepthStencilAttachment = &depthAttachmentRef;
-        subpass.pResolveAttachments = &colorAttachmentResolveRef;
-
-        VkSubpassDependency dependency{};
-        dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
-        dependency.srcAccessMask = 0;
-        dependency.srcStageMask =
-            VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
-        dependency.dstSubpass = 0;
-        dependency.dstStageMask =
-            VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
-        dependency.dstAccessMask =
+        subpass.pResolveAttachments = multisampled ? &colorAttachmentResolveRef : nullptr;
+
+        // The outgoing dependency is only needed by the upscale blit, but it is always declared so
+        // the render pass stays compatible with pipelines when only the render scale changes.
+        // The incoming one also orders the previous frame's writes to the shared transient attachments.
+        VkPipelineStageFlags attachmentStages = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+            VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+
+        std::array<VkSubpassDependency, 2> dependencies{};
+        dependencies[0].srcSubpass = VK_SUBPASS_EXTERNAL;
+        dependencies[0].srcStageMask = attachmentStages;
+        dependencies[0].srcAccessMask =
             VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+        dependencies[0].dstSubpass = 0;
+        dependencies[0].dstStageMask = attachmentStages;
+        dependencies[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+            VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+
+        dependencies[1].srcSubpass = 0;
+        dependencies[1].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+        dependencies[1].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+        dependencies[1].dstSubpass = VK_SUBPASS_EXTERNAL;
+        dependencies[1].dstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        dependencies[1].dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+
+        std::vector<VkAttachmentDescription> attachments = {colorAttachment, depthAttachment};
+        if (multisampled) {
+            attachments.push_back(colorAttachmentResolve);
+        }
 
-        std::array<VkAttachmentDescription, 3> attachments = {colorAttachment, depthAttachment, colorAttachmentResolve};
         VkRenderPassCreateInfo renderPassInfo{};
         renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
         renderPassInfo.attachmentCount = static_cast<uint32_t>(attachments.size());
         renderPassInfo.pAttachments = attachments.data();
         renderPassInfo.subpassCount = 1;
         renderPassInfo.pSubpasses = &subpass;
-        renderPassInfo.dependencyCount = 1;
-        renderPassInfo.pDependencies = &dependency;
+        renderPassInfo.dependencyCount = static_cast<uint32_t>(dependencies.size());
+        renderPassInfo.pDependencies = dependencies.data();
 
         if (vkCreateRenderPass(device.device(), &renderPassInfo, nullptr, &renderPass) != VK_SUCCESS) {
             throw std::runtime_error("failed to create render pass!");
@@ -339,20 +499,22 @@ namespace aurora {
     void AuroraSwapChain::createFramebuffers() {
         swapChainFramebuffers.resize(imageCount());
         for (size_t i = 0; i < imageCount(); i++) {
-            std::array<VkImageView, 3> attachments = {
-                colorImageViews[i],      
-                depthImageViews[i],      
-                swapChainImageViews[i]   
-            };
+            VkImageView outputView = upscaling ? sceneImageViews[i] : swapChainImageViews[i];
+
+            std::vector<VkImageView> attachments;
+            if (device.msaaSamples != VK_SAMPLE_COUNT_1_BIT) {
+                attachments = {colorImageView, depthImageView, outputView};
+            } else {
+                attachments = {outputView, depthImageView};
+            }
 
-            VkExtent2D swapChainExtent = getSwapChainExtent();
             VkFramebufferCreateInfo framebufferInfo{};
             framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
             framebufferInfo.renderPass = renderPass;
             framebufferInfo.attachmentCount = static_cast<uint32_t>(attachments.size());
             framebufferInfo.pAttachments = attachments.data();
-            framebufferInfo.width = swapChainExtent.width;
-            framebufferInfo.height = swapChainExtent.height;
+            framebufferInfo.width = renderExtent.width;
+            framebufferInfo.height = renderExtent.height;
             framebufferInfo.layers = 1;
 
             if (vkCreateFramebuffer(device.device(), &framebufferInfo, nullptr, &swapChainFramebuffers[i]) != VK_SUCCESS) {
@@ -364,53 +526,29 @@ namespace aurora {
     void AuroraSwapChain::createDepthResources() {
         VkFormat depthFormat = findDepthFormat();
         swapChainDepthFormat = depthFormat;
-        
-        VkExtent2D swapChainExtent = getSwapChainExtent();
-
-        depthImages.resize(imageCount());
-        depthImageMemorys.resize(imageCount());
-        depthImageViews.resize(imageCount());
 
-        for (size_t i = 0; i < depthImages.size(); i++) {
-            VkImageCreateInfo imageInfo{};
-            imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
-            imageInfo.imageType = VK_IMAGE_TYPE_2D;
-            imageInfo.extent.width = swapChainExtent.width;
-            imageInfo.extent.height = swapChainExtent.height;
-            imageInfo.extent.depth = 1;
-            imageInfo.mipLevels = 1;
-            imageInfo.arrayLayers = 1;
-            imageInfo.format = depthFormat;
-            imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
-            imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-            imageInfo.usage = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
-            imageInfo.samples = device.msaaSamples;
-            imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-            imageInfo.flags = 0;
-
-            device.createImageWithInfo(imageInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, depthImages[i], depthImageMemorys[i]);
-
-            VkImageViewCreateInfo viewInfo{};
-            viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
-            viewInfo.image = depthImages[i];
-            viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
-            viewInfo.format = depthFormat;
-            viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
-            viewInfo.subresourceRange.baseMipLevel = 0;
-            viewInfo.subresourceRange.levelCount = 1;
-            viewInfo.subresourceRange.baseArrayLayer = 0;
-            viewInfo.subresourceRange.layerCount = 1;
-
-            if (vkCreateImageView(device.device(), &viewInfo, nullptr, &depthImageViews[i]) != VK_SUCCESS) {
-                throw std::runtime_error("failed to create texture image view!");
-            }
-        }
+        VkImageCreateInfo imageInfo{};
+        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        imageInfo.imageType = VK_IMAGE_TYPE_2D;
+        imageInfo.extent.width = renderExtent.width;
+        imageInfo.extent.height = renderExtent.height;
+        imageInfo.extent.depth = 1;
+        imageInfo.mipLevels = 1;
+        imageInfo.arrayLayers = 1;
+        imageInfo.format = depthFormat;
+        imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        imageInfo.usage = VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+        imageInfo.samples = device.msaaSamples;
+        imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        imageInfo.flags = 0;
+
+        createTransientAttachmentImage(imageInfo, VK_IMAGE_ASPECT_DEPTH_BIT, depthImage, depthImageMemory, depthImageView);
     }
 
     void AuroraSwapChain::createSyncObjects() {
         imageAvailableSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
         renderFinishedSemaphores.resize(imageCount());
-        inFlightFences.resize(MAX_FRAMES_IN_FLIGHT);
         imagesInFlight.resize(imageCount(), VK_NULL_HANDLE);
 
         VkSemaphoreCreateInfo semaphoreInfo = {};
@@ -421,12 +559,25 @@ namespace aurora {
         fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
 
         for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
-            if (vkCreateSemaphore(device.device(), &semaphoreInfo, nullptr, &imageAvailableSemaphores[i]) != VK_SUCCESS ||
-                vkCreateFence(device.device(), &fenceInfo, nullptr, &inFlightFences[i]) != VK_SUCCESS) {
+            if (vkCreateSemaphore(device.device(), &semaphoreInfo, nullptr, &imageAvailableSemaphores[i]) != VK_SUCCESS) {
                 throw std::runtime_error("failed to create synchronization objects for a frame!");
             }
         }
 
+        // Keep waiting on the previous chain's fences so frame retirement carries across recreation
+        if (oldSwapChain != nullptr && !oldSwapChain->inFlightFences.empty()) {
+            inFlightFences = std::move(oldSwapChain->inFlightFences);
+            oldSwapChain->inFlightFences.clear();
+            currentFrame = oldSwapChain->currentFrame;
+        } else {
+            inFlightFences.resize(MAX_FRAMES_IN_FLIGHT);
+            for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
+                if (vkCreateFence(device.device(), &fenceInfo, nullptr, &inFlightFences[i]) != VK_SUCCESS) {
+                    throw std::runtime_error("failed to create synchronization objects for a frame!");
+                }
+            }
+        }
+
         for (size_t i = 0; i < imageCount(); i++) {
             if (vkCreateSemaphore(device.device(), &semaphoreInfo, nullptr, &renderFinishedSemaphores[i]) != VK_SUCCESS) {
                 throw std::runtime_error("failed to create synchronization objects for a frame!");
@@ -445,13 +596,15 @@ namespace aurora {
     }
 
     VkPresentModeKHR AuroraSwapChain::chooseSwapPresentMode(const std::vector<VkPresentModeKHR> &availablePresentModes) {
+        VkPresentModeKHR requested = device.getRenderQuality().presentMode;
         for (const auto &availablePresentMode : availablePresentModes) {
-            if (availablePresentMode == VK_PRESENT_MODE_MAILBOX_KHR) {
-                log::engine()->debug("Present mode: Mailbox");
+            if (availablePresentMode == requested) {
+                log::engine()->debug("Present mode: {}", static_cast<int>(requested));
                 return availablePresentMode;
             }
         }
 
+        // FIFO is the only mode every implementation must support
         log::engine()->info("Present mode: V-Sync");
         return VK_PRESENT_MODE_FIFO_KHR;
     }
@@ -0,0 +1,192 @@
+#include "aurora_engine/core/aurora_upload_queue.hpp"
+#include "aurora_engine/profiling/aurora_profiler.hpp"
+#include "aurora_engine/utils/log.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace aurora {
+
+    AuroraUploadQueue::AuroraUploadQueue(AuroraDevice& device, AuroraBufferPool& stagingPool)
+        : device{device}, stagingPool{stagingPool} {
+    }
+
+    AuroraUploadQueue::~AuroraUploadQueue() {
+        for (auto& copy : pendingCopies) {
+            stagingPool.free(copy.staging);
+        }
+        pendingCopies.clear();
+
+        waitIdle();
+
+        for (auto& batch : freeBatches) {
+            vkDestroyFence(device.device(), batch.fence, nullptr);
+            vkFreeCommandBuffers(device.device(), device.getCommandPool(), 1, &batch.commandBuffer);
+        }
+    }
+
+    bool AuroraUploadQueue::uploadBuffer(const BufferAllocation& destination, const void* data, VkDeviceSize size, VkDeviceSize destinationOffset) {
+        if (!destination.isValid() || size == 0) {
+            return false;
+        }
+
+        auto staging = stagingPool.allocate(size);
+        if (!staging.isValid() || !staging.mappedMemory) {
+            log::engine()->error("Failed to allocate {} bytes of staging memory for upload", size);
+            return false;
+        }
+
+        memcpy(staging.mappedMemory, data, (size_t)size);
+        pendingCopies.push_back({staging, destination.buffer, destination.offset + destinationOffset, size});
+        return true;
+    }
+
+    void AuroraUploadQueue::cancel(const BufferAllocation& destination) {
+        auto first = std::remove_if(pendingCopies.begin(), pendingCopies.end(), [&](const PendingCopy& copy) {
+            bool overlaps = copy.dstBuffer == destination.buffer &&
+                            copy.dstOffset < destination.offset + destination.size &&
+                            destination.offset < copy.dstOffset + copy.size;
+            if (overlaps) {
+                stagingPool.free(copy.staging);
+            }
+            return overlaps;
+        });
+        pendingCopies.erase(first, pendingCopies.end());
+    }
+
+    void AuroraUploadQueue::submit() {
+        collectCompletedBatches();
+
+        if (pendingCopies.empty()) {
+            return;
+        }
+
+        AURORA_PROFILE("Upload Queue Submit");
+
+        // Group copies sharing the same source and destination buffers into one vkCmdCopyBuffer
+        std::sort(pendingCopies.begin(), pendingCopies.end(), [](const PendingCopy& a, const PendingCopy& b) {
+            if (a.staging.buffer != b.staging.buffer) return a.staging.buffer < b.staging.buffer;
+            return a.dstBuffer < b.dstBuffer;
+        });
+
+        Batch batch = acquireBatch();
+
+        VkCommandBufferBeginInfo beginInfo{};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+        if (vkBeginCommandBuffer(batch.commandBuffer, &beginInfo) != VK_SUCCESS) {
+            throw std::runtime_error("failed to begin upload command buffer!");
+        }
+
+        VkDeviceSize uploadedBytes = 0;
+        std::vector<VkBufferCopy> regions;
+        for (size_t i = 0; i < pendingCopies.size();) {
+            VkBuffer srcBuffer = pendingCopies[i].staging.buffer;
+            VkBuffer dstBuffer = pendingCopies[i].dstBuffer;
+
+            regions.clear();
+            for (; i < pendingCopies.size() && pendingCopies[i].staging.buffer == srcBuffer && pendingCopies[i].dstBuffer == dstBuffer; ++i) {
+                regions.push_back({pendingCopies[i].staging.offset, pendingCopies[i].dstOffset, pendingCopies[i].size});
+                batch.stagingAllocations.push_back(pendingCopies[i].staging);
+                uploadedBytes += pendingCopies[i].size;
+            }
+
+            vkCmdCopyBuffer(batch.commandBuffer, srcBuffer, dstBuffer, static_cast<uint32_t>(regions.size()), regions.data());
+        }
+
+        // Make the copies visible to vertex input of every later submission on this queue
+        VkMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT;
+
+        vkCmdPipelineBarrier(
+            batch.commandBuffer,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+            0,
+            1, &barrier,
+            0, nullptr,
+            0, nullptr
+        );
+
+        if (vkEndCommandBuffer(batch.commandBuffer) != VK_SUCCESS) {
+            throw std::runtime_error("failed to record upload command buffer!");
+        }
+
+        VkSubmitInfo submitInfo{};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &batch.commandBuffer;
+
+        if (vkQueueSubmit(device.graphicsQueue(), 1, &submitInfo, batch.fence) != VK_SUCCESS) {
+            throw std::runtime_error("failed to submit upload command buffer!");
+        }
+
+        auto& profiler = AuroraProfiler::instance();
+        profiler.incrementCounter("Upload Copies", pendingCopies.size());
+        profiler.incrementCounter("Upload Bytes", uploadedBytes);
+
+        pendingCopies.clear();
+        inFlightBatches.push_back(std::move(batch));
+    }
+
+    void AuroraUploadQueue::waitIdle() {
+        for (auto& batch : inFlightBatches) {
+            vkWaitForFences(device.device(), 1, &batch.fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+        }
+        collectCompletedBatches();
+    }
+
+    AuroraUploadQueue::Batch AuroraUploadQueue::acquireBatch() {
+        if (!freeBatches.empty()) {
+            Batch batch = std::move(freeBatches.back());
+            freeBatches.pop_back();
+            return batch;
+        }
+
+        Batch batch{};
+
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandPool = device.getCommandPool();
+        allocInfo.commandBufferCount = 1;
+
+        if (vkAllocateCommandBuffers(device.device(), &allocInfo, &batch.commandBuffer) != VK_SUCCESS) {
+            throw std::runtime_error("failed to allocate upload command buffer!");
+        }
+
+        VkFenceCreateInfo fenceInfo{};
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+        if (vkCreateFence(device.device(), &fenceInfo, nullptr, &batch.fence) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create upload fence!");
+        }
+
+        return batch;
+    }
+
+    void AuroraUploadQueue::collectCompletedBatches() {
+        // Batches are submitted in order on a single queue, so they also retire in order
+        while (!inFlightBatches.empty() && vkGetFenceStatus(device.device(), inFlightBatches.front().fence) == VK_SUCCESS) {
+            recycleBatch(inFlightBatches.front());
+            freeBatches.push_back(std::move(inFlightBatches.front()));
+            inFlightBatches.pop_front();
+        }
+    }
+
+    void AuroraUploadQueue::recycleBatch(Batch& batch) {
+        for (auto& staging : batch.stagingAllocations) {
+            stagingPool.free(staging);
+        }
+        batch.stagingAllocations.clear();
+
+        vkResetFences(device.device(), 1, &batch.fence);
+        vkResetCommandBuffer(batch.commandBuffer, 0);
+    }
+
+}
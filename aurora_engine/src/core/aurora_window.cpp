@@ -29,6 +29,7 @@ namespace aurora {
         window = glfwCreateWindow(width, height, windowName.c_str(), monitor, nullptr);
         glfwSetWindowUserPointer(window, this);
         glfwSetFramebufferSizeCallback(window, framebufferResizeCallback);
+        glfwSetWindowRefreshCallback(window, windowRefreshCallback);
     }
         
     void AuroraWindow::createWindowSurface(VkInstance instance, VkSurfaceKHR* surface) {
@@ -43,4 +44,9 @@ namespace aurora {
         auroraWindow->width = width;
         auroraWindow->height = height;
     }
+
+    void AuroraWindow::windowRefreshCallback(GLFWwindow* window) {
+        auto auroraWindow = reinterpret_cast<AuroraWindow *>(glfwGetWindowUserPointer(window));
+        auroraWindow->refreshRequested = true;
+    }
 }
\ No newline at end of file
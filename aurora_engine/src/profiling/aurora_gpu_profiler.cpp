@@ -0,0 +1,115 @@
+#include "aurora_engine/profiling/aurora_gpu_profiler.hpp"
+#include "aurora_engine/profiling/aurora_profiler.hpp"
+#include "aurora_engine/core/aurora_deletion_queue.hpp"
+#include "aurora_engine/utils/log.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+namespace aurora {
+
+    AuroraGpuProfiler::AuroraGpuProfiler(AuroraDevice& device, uint32_t frameCount)
+        : device{device}, frames(frameCount) {
+        uint32_t validBits = device.findPhysicalQueueFamilies().graphicsTimestampValidBits;
+        if (validBits == 0 || device.properties.limits.timestampPeriod <= 0.0f) {
+            log::engine()->warn("Graphics queue does not support timestamp queries, GPU profiling disabled");
+            return;
+        }
+
+        supported = true;
+        timestampPeriodMs = static_cast<double>(device.properties.limits.timestampPeriod) / 1e6;
+        timestampMask = validBits >= 64 ? UINT64_MAX : (uint64_t{1} << validBits) - 1;
+        timestamps.resize(MAX_ZONES * 2);
+
+        VkQueryPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        poolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+        poolInfo.queryCount = MAX_ZONES * 2;
+
+        for (auto& frame : frames) {
+            if (vkCreateQueryPool(device.device(), &poolInfo, nullptr, &frame.queryPool) != VK_SUCCESS) {
+                throw std::runtime_error("failed to create timestamp query pool!");
+            }
+            frame.zoneNames.resize(MAX_ZONES);
+        }
+
+        log::engine()->debug("GPU profiler created: {} frames, {} zones, {:.3f} ns per tick",
+            frames.size(), MAX_ZONES, device.properties.limits.timestampPeriod);
+    }
+
+    AuroraGpuProfiler::~AuroraGpuProfiler() {
+        for (auto& frame : frames) {
+            if (frame.queryPool == VK_NULL_HANDLE) continue;
+
+            VkDevice vkDevice = device.device();
+            VkQueryPool queryPool = frame.queryPool;
+            device.getDeletionQueue().push([vkDevice, queryPool]() { vkDestroyQueryPool(vkDevice, queryPool, nullptr); });
+        }
+    }
+
+    void AuroraGpuProfiler::beginFrame(VkCommandBuffer commandBuffer, uint32_t frameIndex) {
+        if (!supported) return;
+        assert(frameIndex < frames.size() && "Frame index out of range");
+
+        currentFrame = frameIndex;
+        auto& frame = frames[frameIndex];
+
+        // The renderer has waited on this slot's fence, so the previous results are available
+        if (frame.submitted) {
+            collectResults(frame);
+        }
+
+        vkCmdResetQueryPool(commandBuffer, frame.queryPool, 0, MAX_ZONES * 2);
+        frame.zoneCount.store(0, std::memory_order_relaxed);
+        frame.submitted = true;
+    }
+
+    uint32_t AuroraGpuProfiler::beginZone(VkCommandBuffer commandBuffer, const std::string& name) {
+        if (!supported || !AuroraProfiler::instance().isEnabled()) return INVALID_ZONE;
+
+        auto& frame = frames[currentFrame];
+        uint32_t zone = frame.zoneCount.fetch_add(1, std::memory_order_relaxed);
+        if (zone >= MAX_ZONES) return INVALID_ZONE;
+
+        frame.zoneNames[zone] = name;
+        vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, frame.queryPool, zone * 2);
+        return zone;
+    }
+
+    void AuroraGpuProfiler::endZone(VkCommandBuffer commandBuffer, uint32_t zone) {
+        if (zone == INVALID_ZONE) return;
+
+        auto& frame = frames[currentFrame];
+        vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, frame.queryPool, zone * 2 + 1);
+    }
+
+    void AuroraGpuProfiler::collectResults(FrameQueries& frame) {
+        uint32_t zoneCount = std::min(frame.zoneCount.load(std::memory_order_relaxed), MAX_ZONES);
+        if (zoneCount == 0) return;
+
+        uint32_t queryCount = zoneCount * 2;
+        VkResult result = vkGetQueryPoolResults(
+            device.device(),
+            frame.queryPool,
+            0,
+            queryCount,
+            queryCount * sizeof(uint64_t),
+            timestamps.data(),
+            sizeof(uint64_t),
+            VK_QUERY_RESULT_64_BIT
+        );
+
+        // VK_NOT_READY means a zone was left open; drop the frame rather than wait for it
+        if (result != VK_SUCCESS) return;
+
+        auto& profiler = AuroraProfiler::instance();
+        for (uint32_t zone = 0; zone < zoneCount; ++zone) {
+            uint64_t begin = timestamps[zone * 2] & timestampMask;
+            uint64_t end = timestamps[zone * 2 + 1] & timestampMask;
+            uint64_t ticks = (end - begin) & timestampMask;
+            profiler.addSample(frame.zoneNames[zone].c_str(), static_cast<double>(ticks) * timestampPeriodMs);
+        }
+    }
+
+}
@@ -1,14 +1,129 @@
 #include "aurora_engine/profiling/aurora_profiler.hpp"
+#include "aurora_engine/utils/log.hpp"
 #include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
 
 namespace aurora {
+    uint32_t AuroraProfiler::internZone(const char* name) {
+        std::lock_guard<std::mutex> lock(zoneMutex_);
+
+        auto it = zoneIds_.find(name);
+        if (it != zoneIds_.end()) {
+            return it->second;
+        }
+
+        uint32_t zoneId = static_cast<uint32_t>(zoneStats_.size());
+        std::lock_guard<std::mutex> dataLock(dataMutex_);
+        zoneStats_.push_back(&stats_[name]);
+        zoneNames_.push_back(&zoneIds_.emplace(name, zoneId).first->first);
+        return zoneId;
+    }
+
+    void AuroraProfiler::beginZone(uint32_t zoneId) {
+        pushEvent(zoneId, EventType::Begin, nowNs());
+    }
+
+    void AuroraProfiler::endZone(uint32_t zoneId) {
+        pushEvent(zoneId, EventType::End, nowNs());
+    }
+
+    void AuroraProfiler::addSample(uint32_t zoneId, double timeMs) {
+        if (!enabled_) return;
+        pushEvent(zoneId, EventType::Sample, static_cast<uint64_t>(timeMs * 1e6));
+    }
+
     void AuroraProfiler::addSample(const char* name, double timeMs) {
         if (!enabled_) return;
+        addSample(internZone(name), timeMs);
+    }
 
-        std::lock_guard<std::mutex> lock(dataMutex_);
-        
-        std::string nameStr(name);
-        auto& stats = stats_[nameStr];
+    AuroraProfiler::ThreadEvents& AuroraProfiler::threadEvents() {
+        // Hands the buffer back when the thread exits so short-lived threads do not grow the list
+        struct ThreadSlot {
+            ThreadEvents* buffer = nullptr;
+            ~ThreadSlot() {
+                if (buffer) buffer->retired.store(true, std::memory_order_release);
+            }
+        };
+        thread_local ThreadSlot slot;
+
+        if (!slot.buffer) {
+            std::lock_guard<std::mutex> lock(zoneMutex_);
+            for (auto& buffer : threadBuffers_) {
+                bool drained = buffer->head.load(std::memory_order_acquire) == buffer->tail.load(std::memory_order_relaxed);
+                if (buffer->retired.load(std::memory_order_acquire) && drained) {
+                    buffer->retired.store(false, std::memory_order_relaxed);
+                    buffer->openZones.clear();
+                    slot.buffer = buffer.get();
+                    break;
+                }
+            }
+
+            if (!slot.buffer) {
+                threadBuffers_.push_back(std::make_unique<ThreadEvents>());
+                slot.buffer = threadBuffers_.back().get();
+                slot.buffer->threadIndex = static_cast<uint32_t>(threadBuffers_.size() - 1);
+            }
+            slot.buffer->threadName = "Thread " + std::to_string(slot.buffer->threadIndex);
+        }
+        return *slot.buffer;
+    }
+
+    void AuroraProfiler::pushEvent(uint32_t zoneId, EventType type, uint64_t value) {
+        auto& buffer = threadEvents();
+
+        uint32_t head = buffer.head.load(std::memory_order_relaxed);
+        if (head - buffer.tail.load(std::memory_order_acquire) >= ThreadEvents::CAPACITY) {
+            buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        buffer.events[head & (ThreadEvents::CAPACITY - 1)] = {zoneId, type, value};
+        buffer.head.store(head + 1, std::memory_order_release);
+    }
+
+    void AuroraProfiler::drainEvents(ThreadEvents& buffer) {
+        uint32_t tail = buffer.tail.load(std::memory_order_relaxed);
+        uint32_t head = buffer.head.load(std::memory_order_acquire);
+
+        for (; tail != head; ++tail) {
+            const Event& event = buffer.events[tail & (ThreadEvents::CAPACITY - 1)];
+
+            switch (event.type) {
+                case EventType::Begin:
+                    buffer.openZones.push_back({event.zoneId, event.value});
+                    break;
+                case EventType::End: {
+                    // Zones whose end was dropped are discarded along with the match
+                    auto& open = buffer.openZones;
+                    for (size_t i = open.size(); i > 0; --i) {
+                        if (open[i - 1].zoneId == event.zoneId) {
+                            accumulate(event.zoneId, static_cast<double>(event.value - open[i - 1].startNs) / 1e6);
+
+                            if (traceFrameCount_ > 0 && pendingTraceFrame_.zones.size() < MAX_TRACE_ZONES_PER_FRAME) {
+                                uint32_t depth = static_cast<uint32_t>(i - 1);
+                                uint32_t parent = depth > 0 ? open[depth - 1].zoneId : NO_PARENT;
+                                pendingTraceFrame_.zones.push_back({event.zoneId, parent, buffer.threadIndex, depth, open[i - 1].startNs, event.value});
+                            }
+                            open.resize(i - 1);
+                            break;
+                        }
+                    }
+                    break;
+                }
+                case EventType::Sample:
+                    accumulate(event.zoneId, static_cast<double>(event.value) / 1e6);
+                    break;
+            }
+        }
+
+        buffer.tail.store(head, std::memory_order_release);
+    }
+
+    void AuroraProfiler::accumulate(uint32_t zoneId, double timeMs) {
+        auto& stats = *zoneStats_[zoneId];
         
         stats.current += timeMs;
         stats.sampleCount++;
@@ -22,10 +137,6 @@ namespace aurora {
         
         stats.minimum = std::min(stats.minimum, timeMs);
         stats.maximum = std::max(stats.maximum, timeMs);
-        
-        if (currentFrameTime_ > 0.0) {
-            stats.framePercentage = (stats.current / currentFrameTime_) * 100.0;
-        }
     }
 
     const AuroraProfiler::StatisticalData& AuroraProfiler::getStats(const char* name) const {
@@ -55,25 +166,221 @@ namespace aurora {
 
     uint64_t AuroraProfiler::getCounter(const char* name) const {
         std::lock_guard<std::mutex> lock(const_cast<std::mutex&>(dataMutex_));
-        auto it = counters_.find(name);
-        if (it != counters_.end()) {
+        auto it = frameCounters_.find(name);
+        if (it != frameCounters_.end()) {
             return it->second;
         }
         return 0;
     }
 
     const std::unordered_map<std::string, uint64_t>& AuroraProfiler::getCounters() const {
-        return counters_;
+        return frameCounters_;
+    }
+
+    void AuroraProfiler::setStartupTime(const char* phase, double timeMs) {
+        std::lock_guard<std::mutex> lock(dataMutex_);
+        for (auto& [name, time] : startupTimes_) {
+            if (name == phase) {
+                time = timeMs;
+                return;
+            }
+        }
+        startupTimes_.emplace_back(phase, timeMs);
+    }
+
+    double AuroraProfiler::getStartupTime(const char* phase) const {
+        std::lock_guard<std::mutex> lock(const_cast<std::mutex&>(dataMutex_));
+        for (const auto& [name, time] : startupTimes_) {
+            if (name == phase) {
+                return time;
+            }
+        }
+        return 0.0;
+    }
+
+    std::vector<std::pair<std::string, double>> AuroraProfiler::getStartupTimes() const {
+        std::lock_guard<std::mutex> lock(const_cast<std::mutex&>(dataMutex_));
+        return startupTimes_;
+    }
+
+    void AuroraProfiler::beginFrame() {
+        std::lock_guard<std::mutex> lock(zoneMutex_);
+        frameStartNs_ = nowNs();
     }
 
     void AuroraProfiler::newFrame() {
+        std::lock_guard<std::mutex> zoneLock(zoneMutex_);
         std::lock_guard<std::mutex> lock(dataMutex_);
         for (auto& [name, stats] : stats_) {
             stats.current = 0.0;
             stats.framePercentage = 0.0;
         }
+        frameCounters_ = counters_;
         for (auto& [name, value] : counters_) {
            value = 0;
         }
+
+        // Stats describe the frame that just ended until the next call
+        uint64_t dropped = 0;
+        for (auto& buffer : threadBuffers_) {
+            drainEvents(*buffer);
+            dropped += buffer->dropped.exchange(0, std::memory_order_relaxed);
+        }
+
+        if (currentFrameTime_ > 0.0) {
+            for (auto& [name, stats] : stats_) {
+                stats.framePercentage = (stats.current / currentFrameTime_) * 100.0;
+            }
+        }
+
+        if (dropped > 0) {
+            frameCounters_["Profiler Dropped Events"] = dropped;
+        }
+
+        uint64_t endNs = nowNs();
+        double frameMs = frameStartNs_ > 0 ? static_cast<double>(endNs - frameStartNs_) / 1e6 : 0.0;
+        retireTraceFrame(endNs);
+
+        if (slowFrameThresholdMs_ > 0.0 && frameMs > slowFrameThresholdMs_ && frameNumber_ >= nextCaptureFrame_) {
+            // Skip the frames already in this capture so one hitch does not produce a file per frame
+            nextCaptureFrame_ = frameNumber_ + traceFrameCount_;
+            std::string path = slowFrameDirectory_ + "/aurora_trace_frame_" + std::to_string(frameNumber_ - 1) + ".json";
+            if (writeChromeTrace(path)) {
+                log::engine()->warn("Frame {} took {:.2f} ms, trace written to {}", frameNumber_ - 1, frameMs, path);
+            }
+        }
+    }
+
+    void AuroraProfiler::setTraceFrameCount(size_t frameCount) {
+        std::lock_guard<std::mutex> lock(zoneMutex_);
+        traceFrameCount_ = frameCount;
+        traceFrames_.clear();
+        traceFrames_.shrink_to_fit();
+        traceCursor_ = 0;
+        pendingTraceFrame_.zones.clear();
+    }
+
+    void AuroraProfiler::setThreadName(const char* name) {
+        auto& buffer = threadEvents();
+        std::lock_guard<std::mutex> lock(zoneMutex_);
+        buffer.threadName = name;
+    }
+
+    void AuroraProfiler::setSlowFrameCapture(double thresholdMs, const std::string& directory) {
+        std::lock_guard<std::mutex> lock(zoneMutex_);
+        slowFrameThresholdMs_ = thresholdMs;
+        slowFrameDirectory_ = directory;
+
+        if (thresholdMs > 0.0) {
+            std::error_code error;
+            std::filesystem::create_directories(directory, error);
+            if (error) {
+                log::engine()->error("Failed to create trace directory {}: {}", directory, error.message());
+            }
+        }
+    }
+
+    bool AuroraProfiler::exportChromeTrace(const std::string& path) {
+        std::lock_guard<std::mutex> lock(zoneMutex_);
+        return writeChromeTrace(path);
+    }
+
+    void AuroraProfiler::retireTraceFrame(uint64_t endNs) {
+        pendingTraceFrame_.frameNumber = frameNumber_++;
+        pendingTraceFrame_.startNs = frameStartNs_ > 0 ? frameStartNs_ : endNs;
+        pendingTraceFrame_.endNs = endNs;
+
+        if (traceFrameCount_ == 0) return;
+
+        // Frames are recycled in place so their zone vectors keep their capacity
+        if (traceFrames_.size() < traceFrameCount_) {
+            traceFrames_.emplace_back();
+        }
+        auto& slot = traceFrames_[traceCursor_];
+        std::swap(slot, pendingTraceFrame_);
+        pendingTraceFrame_.zones.clear();
+        traceCursor_ = (traceCursor_ + 1) % traceFrameCount_;
+    }
+
+    namespace {
+        void writeJsonString(std::ostream& out, const std::string& value) {
+            out << '"';
+            for (char c : value) {
+                switch (c) {
+                    case '"': out << "\\\""; break;
+                    case '\\': out << "\\\\"; break;
+                    case '\n': out << "\\n"; break;
+                    case '\t': out << "\\t"; break;
+                    default:
+                        if (static_cast<unsigned char>(c) < 0x20) {
+                            out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+                        } else {
+                            out << c;
+                        }
+                }
+            }
+            out << '"';
+        }
+    }
+
+    bool AuroraProfiler::writeChromeTrace(const std::string& path) {
+        if (traceFrames_.empty()) {
+            log::engine()->warn("No profiler frames to export");
+            return false;
+        }
+
+        std::ofstream out(path);
+        if (!out.is_open()) {
+            log::engine()->error("Failed to open trace file: {}", path);
+            return false;
+        }
+
+        // Oldest frame first; after wrapping it sits at the cursor
+        size_t first = traceFrames_.size() < traceFrameCount_ ? 0 : traceCursor_;
+        uint64_t originNs = traceFrames_[first].startNs;
+        auto toMicros = [originNs](uint64_t ns) { return static_cast<double>(ns - std::min(ns, originNs)) / 1e3; };
+
+        out << std::fixed << std::setprecision(3);
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+        // Thread 0 carries the frame boundaries, profiled threads follow
+        out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Frames\"}}";
+        for (const auto& buffer : threadBuffers_) {
+            out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadIndex + 1 << ",\"args\":{\"name\":";
+            writeJsonString(out, buffer->threadName);
+            out << "}}";
+        }
+
+        size_t zoneCount = 0;
+        for (size_t i = 0; i < traceFrames_.size(); ++i) {
+            const auto& frame = traceFrames_[(first + i) % traceFrames_.size()];
+
+            out << ",\n{\"name\":\"Frame " << frame.frameNumber << "\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":0"
+                << ",\"ts\":" << toMicros(frame.startNs) << ",\"dur\":" << toMicros(frame.endNs) - toMicros(frame.startNs) << "}";
+
+            for (const auto& zone : frame.zones) {
+                out << ",\n{\"name\":";
+                writeJsonString(out, *zoneNames_[zone.zoneId]);
+                out << ",\"cat\":\"zone\",\"ph\":\"X\",\"pid\":1,\"tid\":" << zone.threadIndex + 1
+                    << ",\"ts\":" << toMicros(zone.startNs) << ",\"dur\":" << toMicros(zone.endNs) - toMicros(zone.startNs)
+                    << ",\"args\":{\"frame\":" << frame.frameNumber << ",\"depth\":" << zone.depth;
+                if (zone.parentZoneId != NO_PARENT) {
+                    out << ",\"parent\":";
+                    writeJsonString(out, *zoneNames_[zone.parentZoneId]);
+                }
+                out << "}}";
+            }
+            zoneCount += frame.zones.size();
+        }
+
+        out << "\n]}\n";
+
+        if (!out.good()) {
+            log::engine()->error("Failed to write trace file: {}", path);
+            return false;
+        }
+
+        log::engine()->info("Exported {} frames ({} zones) to {}", traceFrames_.size(), zoneCount, path);
+        return true;
     }
 }
@@ -5,8 +5,10 @@
 #include "aurora_engine/core/aurora_renderer.hpp"
 #include "aurora_ui/graphics/aurora_render_system_manager.hpp"
 #include "aurora_ui/components/aurora_component_info.hpp"
+#include <chrono>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace aurora {
     class AuroraUI {
@@ -14,6 +16,11 @@ namespace aurora {
             static constexpr int WIDTH = 1920;
             static constexpr int HEIGHT = 1080;
 
+            // Continuous records a frame every iteration; OnDemand blocks on window events and
+            // only renders once the scene has been marked dirty.
+            enum class RenderMode { Continuous, OnDemand };
+            static constexpr double IDLE_WAIT_TIMEOUT_SECONDS = 0.25;
+
             explicit AuroraUI(const std::string& title = "Aurora");
             virtual ~AuroraUI();
 
@@ -22,16 +29,52 @@ namespace aurora {
 
             void run();
 
+            void setRenderMode(RenderMode mode) { renderMode = mode; }
+            RenderMode getRenderMode() const { return renderMode; }
+
+            // Thread safe, wakes the loop from glfwWaitEventsTimeout
+            void requestRedraw();
+            static void wake();
+
+            uint64_t getSkippedFrameCount() const { return skippedFrameCount; }
+
+            // Rebuilds the swap chain and pipelines before the next frame
+            void setRenderQuality(const RenderQuality& quality);
+            const RenderQuality& getRenderQuality() const { return auroraDevice.getRenderQuality(); }
+
+            void setFrameRateLimit(bool enable) { frameRateLimit = enable; }
+
+            // Creates the pipelines from getWarmUpPipelines() in parallel before onSetup, so the first
+            // frame does not build them one after another. On by default.
+            void setPipelineWarmUp(bool enable) { pipelineWarmUp = enable; }
+            void requestClose() { auroraWindow.requestClose(); }
+
         protected:
             virtual void onSetup(AuroraComponentInfo&) {}
 
             virtual void onUpdate(float) {}
 
+            // Pipelines of the built-in components; apps with their own component types add theirs
+            virtual std::vector<PipelineDescriptor> getWarmUpPipelines() const;
+
+            AuroraRenderer& getRenderer() { return auroraRenderer; }
+
         private:
+            bool needsRedraw();
+            void logStartupTimes();
+
+            // Declared first so it is taken before the window and device are created
+            std::chrono::steady_clock::time_point startupBegin = std::chrono::steady_clock::now();
+
             AuroraWindow auroraWindow;
             AuroraDevice auroraDevice;
             AuroraRenderer auroraRenderer;
 
             std::unique_ptr<AuroraRenderSystemManager> renderSystemManager;
+
+            RenderMode renderMode = RenderMode::Continuous;
+            uint64_t skippedFrameCount = 0;
+            bool frameRateLimit = true;
+            bool pipelineWarmUp = true;
     };
 }
\ No newline at end of file
@@ -9,22 +9,19 @@ namespace aurora {
         public:
             AuroraCard(AuroraComponentInfo &componentInfo, glm::vec2 size, glm::vec4 borderColor);
 
-            const std::string& getVertexShaderPath() const override {
-                static const std::string vertexPath = "shaders/shader.vert.spv";
-                return vertexPath;
-            }
-            
-            const std::string& getFragmentShaderPath() const override {
-                static const std::string fragmentPath = "shaders/shader.frag.spv";
-                return fragmentPath;
-            }
-            
-            VkPrimitiveTopology getTopology() const override {
-                return VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+            static constexpr PipelineDescriptor PIPELINE = PipelineDescriptor{"shaders/shape.vert.spv", "shaders/shape.frag.spv"}
+                .withInstancing(InstancingMode::SHAPE);
+
+            const PipelineDescriptor& getPipeline() const override {
+                return PIPELINE;
             }
 
+            void appendShapeInstances(std::vector<ShapeInstance>& instances) const override;
+
         private:
-            void initialize() override;
+            static constexpr float CORNER_RADIUS = 50.0f;
+            static constexpr float BORDER_WIDTH = 6.0f;
+            static constexpr float SHADOW_BLUR = 15.0f;
 
             glm::vec2 size;
             glm::vec4 borderColor;
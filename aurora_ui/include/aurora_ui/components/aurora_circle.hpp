@@ -7,24 +7,16 @@ namespace aurora {
         public:
             AuroraCircle(AuroraComponentInfo &componentInfo, float radius, glm::vec4 color);
 
-            const std::string& getVertexShaderPath() const override {
-                static const std::string vertexPath = "shaders/shader.vert.spv";
-                return vertexPath;
-            }
-            
-            const std::string& getFragmentShaderPath() const override {
-                static const std::string fragmentPath = "shaders/shader.frag.spv";
-                return fragmentPath;
-            }
-            
-            VkPrimitiveTopology getTopology() const override {
-                return VK_PRIMITIVE_TOPOLOGY_TRIANGLE_FAN;
+            static constexpr PipelineDescriptor PIPELINE = PipelineDescriptor{"shaders/shape.vert.spv", "shaders/shape.frag.spv"}
+                .withInstancing(InstancingMode::SHAPE);
+
+            const PipelineDescriptor& getPipeline() const override {
+                return PIPELINE;
             }
 
-        private:
-            void initialize() override;
-            std::vector<AuroraModel::Vertex> createCircleVertices(int numSegments);
+            void appendShapeInstances(std::vector<ShapeInstance>& instances) const override;
 
+        private:
             float radius;
     };
 }
\ No newline at end of file
@@ -1,86 +1,98 @@
 #pragma once
 
 #include "aurora_ui/graphics/aurora_model.hpp"
+#include "aurora_ui/graphics/aurora_glyph_instance.hpp"
+#include "aurora_ui/graphics/aurora_shape_instance.hpp"
+#include "aurora_ui/graphics/aurora_pipeline_key.hpp"
 #include "aurora_ui/components/aurora_component_info.hpp"
+#include "aurora_ui/graphics/aurora_scene_store.hpp"
 
 #include <memory>
 #include <glm/glm.hpp>
-#include <glm/gtc/matrix_transform.hpp>
 
 namespace aurora {
-    struct TransformComponent {
-        glm::vec3 translation{};
-        glm::vec2 scale{1.f, 1.f};
-        float rotation = 0.0f;
-
-        glm::mat4 mat4() const {
-            glm::mat4 transform = glm::mat4(1.0f);
-            transform = glm::translate(transform, translation);
-            transform = glm::rotate(transform, rotation, glm::vec3(0.0f, 0.0f, 1.0f));
-            transform = glm::scale(transform, glm::vec3(scale.x, scale.y, 1.0f));
-            return transform;
-        }
-    };
-    
+    class AuroraRenderSystem;
+
     class AuroraComponentInterface : public std::enable_shared_from_this<AuroraComponentInterface> {
         public:
-            explicit AuroraComponentInterface(AuroraComponentInfo &componentInfo) : componentInfo{componentInfo} {
-                updateWorldTransform();
-            }
-            virtual ~AuroraComponentInterface() = default;
+            // Transform, color and visibility live in the scene store; the component keeps a handle
+            explicit AuroraComponentInterface(AuroraComponentInfo &componentInfo);
+            virtual ~AuroraComponentInterface();
 
             virtual void update(float) {};
+
+            // Called on the main thread before every recorded frame for components registered with
+            // AuroraRenderSystemManager::registerPreRender, to apply work deferred until then
+            virtual void prepareRender() {}
             
-            bool isHidden() const { return hidden; }
-            void setHidden(bool value) { hidden = value; }
-            
-            virtual const std::string& getVertexShaderPath() const = 0;
-            virtual const std::string& getFragmentShaderPath() const = 0;
-            virtual VkPrimitiveTopology getTopology() const = 0;
-            
-            virtual bool needsTextureBinding() const {
-                return false;
+            bool isHidden() const { return scene.isHidden(node); }
+            void setHidden(bool value) {
+                if (isHidden() != value) {
+                    scene.setHidden(node, value);
+                    markDirty();
+                }
             }
-            
-            virtual bool isTransparent() const {
-                return false;
+
+            const glm::vec4& getColor() const { return scene.getColor(node); }
+            void setColor(const glm::vec4& value) {
+                if (getColor() != value) {
+                    scene.setColor(node, value);
+                    markDirty();
+                }
             }
             
+            // Components sharing a descriptor share a render system; each type returns a constexpr one
+            virtual const PipelineDescriptor& getPipeline() const = 0;
+
+            // Glyph-instanced components have no model; they append screen-space quads instead
+            virtual void appendGlyphInstances(std::vector<GlyphInstance>&) const {}
+
+            // Shape-instanced components have no model; they append SDF quads drawn by shape.frag
+            virtual void appendShapeInstances(std::vector<ShapeInstance>&) const {}
+            
             std::shared_ptr<AuroraModel> model{};
-            glm::vec4 color = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-            TransformComponent transform{};
 
             virtual void addChild(std::shared_ptr<AuroraComponentInterface> child) {
                 child->parent = weak_from_this();
                 children.push_back(child);
+                scene.setParent(child->node, node);
+                markDirty();
 
                 if (rendering) {
                     child->addToRenderSystem();
                 }
             }
 
+            // Detaches the child's subtree from the render systems and from this component. The
+            // subtree is freed, models included, once nothing else holds it.
+            void removeChild(const std::shared_ptr<AuroraComponentInterface>& child);
+
             virtual void addToRenderSystem();
 
-            glm::mat4 getWorldTransform() const {
-                return worldTransform;
-            }
+            // Setters only flag the transform; the render system manager resolves the scene once per
+            // frame. Reading a stale transform resolves its subtree first.
+            glm::mat4 getWorldTransform() const { return scene.getWorldTransform(node); }
+
+            const TransformComponent& getTransform() const { return scene.getLocalTransform(node); }
 
             std::vector<std::shared_ptr<AuroraComponentInterface>>& getChildren() {
                 return children;
             }
             
             void setDepth(float depth) {
-                if (transform.translation.z != depth) {
+                if (getTransform().translation.z != depth) {
+                    TransformComponent transform = getTransform();
                     transform.translation.z = depth;
-                    updateWorldTransform();
+                    setTransform(transform);
                 }
             }
             
             void setPosition(float x, float y) {
-                if (transform.translation.x != x || transform.translation.y != y) {
+                if (getTransform().translation.x != x || getTransform().translation.y != y) {
+                    TransformComponent transform = getTransform();
                     transform.translation.x = x;
                     transform.translation.y = y;
-                    updateWorldTransform();
+                    setTransform(transform);
                 }
             }
             
@@ -89,10 +101,11 @@ namespace aurora {
             }
 
             void setScale(float x, float y) {
-                if (transform.scale.x != x || transform.scale.y != y) {
+                if (getTransform().scale.x != x || getTransform().scale.y != y) {
+                    TransformComponent transform = getTransform();
                     transform.scale.x = x;
                     transform.scale.y = y;
-                    updateWorldTransform();
+                    setTransform(transform);
                 }
             }
 
@@ -101,9 +114,10 @@ namespace aurora {
             }
 
             void setRotation(float rotation) {
-                if (transform.rotation != rotation) {
+                if (getTransform().rotation != rotation) {
+                    TransformComponent transform = getTransform();
                     transform.rotation = rotation;
-                    updateWorldTransform();
+                    setTransform(transform);
                 }
             }
 
@@ -112,33 +126,41 @@ namespace aurora {
             }
             
         protected:
+            // Flags the scene for redraw when rendering on demand and queues this component's
+            // instances to be rewritten by its render system
+            void markDirty();
+
+            // Local rect covering everything the component draws, used for culling and picking.
+            // Components that never set it are always drawn and never picked.
+            void setLocalBounds(glm::vec2 min, glm::vec2 max) { scene.setLocalBounds(node, min, max); }
+
             AuroraComponentInfo &componentInfo;
             std::vector<std::shared_ptr<AuroraComponentInterface>> children;
             std::weak_ptr<AuroraComponentInterface> parent;
             
         private:
+            friend class AuroraRenderSystem;
+            friend class AuroraRenderSystemManager;
+            friend class AuroraSceneStore;
+
             virtual void initialize() {};
 
-            bool hidden = false;
             bool rendering = false;
 
-            glm::mat4 worldTransform{1.0f};
-
-            void updateWorldTransform() {
-                glm::mat4 localTransform = transform.mat4();
-                
-                if (auto parentPtr = parent.lock()) {
-                    float ourZDepth = localTransform[3][2];
-                    worldTransform = parentPtr->getWorldTransform() * localTransform;
-                    worldTransform[3][2] = ourZDepth;
-                } else {
-                    worldTransform = localTransform;
-                }
-                
-                for (const auto& child : children) {
-                    child->updateWorldTransform();
-                }
-            }
+            // Owning render system, this component's slot in it and the instance range it keeps
+            AuroraRenderSystem* renderSystem = nullptr;
+            uint32_t systemSlot = UINT32_MAX;
+            uint32_t instanceRange = UINT32_MAX;
 
+            // Position in the manager's component list while added
+            uint32_t managerSlot = UINT32_MAX;
+
+            AuroraSceneStore& scene;
+            AuroraSceneStore::NodeId node;
+
+            void setTransform(const TransformComponent& transform) {
+                scene.setLocalTransform(node, transform);
+                markDirty();
+            }
     };
 }
\ No newline at end of file
@@ -51,18 +51,10 @@ namespace aurora {
 
             AuroraPanelSection& addSection(const std::string& title);
 
-            const std::string& getVertexShaderPath() const override {
-                static const std::string vertexPath = "shaders/shader.vert.spv";
-                return vertexPath;
-            }
-
-            const std::string& getFragmentShaderPath() const override {
-                static const std::string fragmentPath = "shaders/shader.frag.spv";
-                return fragmentPath;
-            }
+            static constexpr PipelineDescriptor PIPELINE = PipelineDescriptor{"shaders/shader.vert.spv", "shaders/shader.frag.spv"};
 
-            VkPrimitiveTopology getTopology() const override {
-                return VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+            const PipelineDescriptor& getPipeline() const override {
+                return PIPELINE;
             }
 
         private:
@@ -7,23 +7,16 @@ namespace aurora {
         public:
             AuroraRoundedRectangle(AuroraComponentInfo &componentInfo, glm::vec2 size, float radius);
 
-            const std::string& getVertexShaderPath() const override {
-                static const std::string vertexPath = "shaders/shader.vert.spv";
-                return vertexPath;
-            }
-            
-            const std::string& getFragmentShaderPath() const override {
-                static const std::string fragmentPath = "shaders/shader.frag.spv";
-                return fragmentPath;
-            }
-            
-            VkPrimitiveTopology getTopology() const override {
-                return VK_PRIMITIVE_TOPOLOGY_TRIANGLE_FAN;
+            static constexpr PipelineDescriptor PIPELINE = PipelineDescriptor{"shaders/shape.vert.spv", "shaders/shape.frag.spv"}
+                .withInstancing(InstancingMode::SHAPE);
+
+            const PipelineDescriptor& getPipeline() const override {
+                return PIPELINE;
             }
 
-        private:
-            void initialize() override;
+            void appendShapeInstances(std::vector<ShapeInstance>& instances) const override;
 
+        private:
             glm::vec2 size;
             float radius;
     };
@@ -1,35 +1,47 @@
 #pragma once
 
 #include "aurora_component_interface.hpp"
+#include "aurora_ui/utils/aurora_scrollback.hpp"
 
+#include <memory>
 #include <string>
 #include <vector>
 
 namespace aurora {
+    class AuroraText;
+
+    // Lines live in a fixed-capacity scrollback ring and are drawn by a fixed pool of text rows,
+    // one per visible line. Appending only writes into the ring; the rows are rebound to the lines
+    // in view once per frame, and only rows whose line changed are laid out again.
     class AuroraTerminal : public AuroraComponentInterface {
         public:
-            AuroraTerminal(AuroraComponentInfo &componentInfo, glm::vec2 size, float fontSize = 15.0f, float padding = 40.0f);
+            AuroraTerminal(AuroraComponentInfo &componentInfo, glm::vec2 size, float fontSize = 15.0f, float padding = 40.0f, size_t scrollbackLines = 10000);
+            ~AuroraTerminal() override;
 
-            const std::string& getVertexShaderPath() const override {
-                static const std::string vertexPath = "shaders/shader.vert.spv";
-                return vertexPath;
-            }
-            
-            const std::string& getFragmentShaderPath() const override {
-                static const std::string fragmentPath = "shaders/shader.frag.spv";
-                return fragmentPath;
-            }
-            
-            VkPrimitiveTopology getTopology() const override {
-                return VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+            static constexpr PipelineDescriptor PIPELINE = PipelineDescriptor{"shaders/shader.vert.spv", "shaders/shader.frag.spv"};
+
+            const PipelineDescriptor& getPipeline() const override {
+                return PIPELINE;
             }
 
-            void addText(const std::string& text);
+            void addText(std::string_view text);
+            void clear();
+
+            // Scroll offset in lines from the newest one; while scrolled up the view stays on the
+            // same lines as new ones arrive
+            void scrollBy(int lines);
+            void setScrollOffset(size_t offset);
+            size_t getScrollOffset() const { return scrollOffset; }
+            void scrollToBottom() { setScrollOffset(0); }
+
+            const AuroraScrollback& getScrollback() const { return scrollback; }
+
+            void prepareRender() override;
 
         private:
             void initialize() override;
             void calculateDimensions();
-            std::vector<std::string> wrapText(const std::string& text, size_t maxWidth);
+            size_t getMaxScrollOffset() const;
             void refreshDisplay();
 
             glm::vec2 size;
@@ -38,7 +50,14 @@ namespace aurora {
             float lineHeight;
             int maxLines;
             int maxCharsPerLine;
-            
-            std::vector<std::string> lines;
+
+            AuroraScrollback scrollback;
+            size_t scrollOffset = 0;
+            bool displayDirty = false;
+
+            // Row r shows the line whose sequence number is congruent to r, so scrolling by one
+            // line only rebinds one row
+            std::vector<std::shared_ptr<AuroraText>> rows;
+            std::vector<uint64_t> rowLines;
     };
 }
\ No newline at end of file
@@ -17,27 +17,16 @@ namespace aurora {
             AuroraText(AuroraComponentInfo &componentInfo, const std::string& text, float fontSize = 24.0f, glm::vec4 fontColor = AuroraThemeSettings::get().TEXT_PRIMARY);
             AuroraText(AuroraComponentInfo &componentInfo, std::vector<TextSegment> segments, float fontSize = 24.0f);
 
-            const std::string& getVertexShaderPath() const override {
-                static const std::string vertexPath = "shaders/text.vert.spv";
-                return vertexPath;
-            }
-
-            const std::string& getFragmentShaderPath() const override {
-                static const std::string fragmentPath = "shaders/text.frag.spv";
-                return fragmentPath;
-            }
+            static constexpr PipelineDescriptor PIPELINE = PipelineDescriptor{"shaders/text.vert.spv", "shaders/text.frag.spv"}
+                .withInstancing(InstancingMode::GLYPH)
+                .withDepth(DepthMode::READ_ONLY)
+                .withTextureBinding();
 
-            VkPrimitiveTopology getTopology() const override {
-                return VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+            const PipelineDescriptor& getPipeline() const override {
+                return PIPELINE;
             }
 
-            bool needsTextureBinding() const override {
-                return true;
-            }
-
-            bool isTransparent() const override {
-                return true;
-            }
+            void appendGlyphInstances(std::vector<GlyphInstance>& instances) const override;
 
             void setText(const std::string& newText);
             const std::string& getText() const { return cachedFullText; }
@@ -52,8 +41,15 @@ namespace aurora {
 
             void rebuildGeometry();
         private:
+            struct Glyph {
+                glm::vec2 position;
+                glm::vec2 size;
+                glm::vec4 uvRect;
+                glm::vec4 color;
+            };
+
             void initialize() override;
-            void updateTextVertices();
+            void layoutGlyphs();
 
             std::vector<TextSegment> segments;
             float fontSize;
@@ -61,7 +57,6 @@ namespace aurora {
 
             std::string cachedFullText;
 
-            size_t currentVertexCapacity = 0;
-            std::vector<AuroraModel::Vertex> cachedVertices;
+            std::vector<Glyph> glyphs;
     };
 }
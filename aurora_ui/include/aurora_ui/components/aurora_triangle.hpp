@@ -7,18 +7,10 @@ namespace aurora {
         public:
             AuroraTriangle(AuroraComponentInfo &componentInfo);
 
-            const std::string& getVertexShaderPath() const override {
-                static const std::string vertexPath = "shaders/shader.vert.spv";
-                return vertexPath;
-            }
-            
-            const std::string& getFragmentShaderPath() const override {
-                static const std::string fragmentPath = "shaders/shader.frag.spv";
-                return fragmentPath;
-            }
-            
-            VkPrimitiveTopology getTopology() const override {
-                return VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+            static constexpr PipelineDescriptor PIPELINE = PipelineDescriptor{"shaders/shader.vert.spv", "shaders/shader.frag.spv"};
+
+            const PipelineDescriptor& getPipeline() const override {
+                return PIPELINE;
             }
 
         private:
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "aurora_model.hpp"
+
+#include <functional>
+#include <memory>
+#include <unordered_map>
+
+namespace aurora {
+    enum class GeometryShape : uint8_t {
+        TRIANGLE,
+    };
+
+    struct GeometryKey {
+        GeometryShape shape;
+        glm::vec2 size{1.0f, 1.0f};
+
+        bool operator==(const GeometryKey& other) const {
+            return shape == other.shape && size == other.size;
+        }
+    };
+
+    struct GeometryKeyHash {
+        size_t operator()(const GeometryKey& key) const;
+    };
+
+    // Hands out one model per distinct shape. Render systems batch by model, so components that
+    // acquire the same key are drawn as a single instanced draw. The cache only holds weak
+    // references; a model is released once the last component using it is destroyed.
+    class AuroraGeometryCache {
+        public:
+            using BuildFunction = std::function<AuroraModel::Builder()>;
+
+            AuroraGeometryCache(AuroraDevice& device) : device{device} {}
+
+            AuroraGeometryCache(const AuroraGeometryCache&) = delete;
+            AuroraGeometryCache& operator=(const AuroraGeometryCache&) = delete;
+
+            // Builds the model with `build` only when no live model matches the key
+            std::shared_ptr<AuroraModel> acquire(const GeometryKey& key, const BuildFunction& build);
+
+            size_t getModelCount() const { return models.size(); }
+
+        private:
+            void pruneExpired();
+
+            AuroraDevice& device;
+            std::unordered_map<GeometryKey, std::weak_ptr<AuroraModel>, GeometryKeyHash> models;
+
+            // Expired entries are swept once the map doubles past its last live size
+            size_t pruneThreshold = 64;
+    };
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "aurora_engine/core/aurora_device.hpp"
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+
+#include <vector>
+
+namespace aurora {
+    // One screen-space glyph quad. The vertex shader expands it to six vertices from
+    // gl_VertexIndex, so text needs neither a vertex nor an index buffer.
+    struct GlyphInstance {
+        glm::vec2 position;
+        glm::vec2 size;
+        glm::vec4 uvRect;
+        float depth;
+        uint32_t color;
+
+        static uint32_t packColor(const glm::vec4& color);
+
+        static std::vector<VkVertexInputBindingDescription> getBindingDescriptions();
+        static std::vector<VkVertexInputAttributeDescription> getAttributeDescriptions();
+    };
+
+    static_assert(sizeof(GlyphInstance) == 40, "GlyphInstance layout must match text.vert");
+}
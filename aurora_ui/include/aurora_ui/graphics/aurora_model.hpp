@@ -12,26 +12,35 @@
 namespace aurora {
     class AuroraModel {
         public:
+            // 32 bytes: a 2x3 affine transform, the depth used for ordering and an RGBA8 color
             struct InstanceData {
-                glm::mat4 modelMatrix;
-                glm::vec4 color;
+                glm::vec4 linear; // 2x2 part, column-major
+                glm::vec2 translation;
+                float depth;
+                uint32_t color;
+
+                static InstanceData fromWorldTransform(const glm::mat4& world, const glm::vec4& color);
             };
 
+            // 16 bytes: 2D position, RGBA8 color and 16-bit normalized texture coordinates. The UI is
+            // flat, depth comes from the instance.
             struct Vertex {
-                glm::vec3 position;
-                glm::vec4 color;
-                glm::vec2 texCoord;
+                glm::vec2 position;
+                uint32_t color;
+                uint16_t texCoord[2];
 
                 Vertex() = default;
 
-                Vertex(const glm::vec3& pos, const glm::vec4& col) : position(pos), color(col), texCoord(0.0f, 0.0f) {}
+                Vertex(const glm::vec3& pos, const glm::vec4& col);
 
-                Vertex(const glm::vec2& pos, const glm::vec4& col) : position(pos.x, pos.y, 0.0f), color(col), texCoord(0.0f, 0.0f) {}
+                Vertex(const glm::vec2& pos, const glm::vec4& col);
 
                 static std::vector<VkVertexInputBindingDescription> getBindingDescriptions();
                 static std::vector<VkVertexInputAttributeDescription> getAttributeDescriptions();
             };
 
+            static uint32_t packColor(const glm::vec4& color);
+
             struct Builder {
                 std::vector<Vertex> vertices{};
                 std::vector<uint32_t> indices{};
@@ -61,6 +70,9 @@ namespace aurora {
 
             bool isDynamic() const { return isDynamicModel; }
 
+            // Models currently alive, reported as a profiler counter
+            static uint32_t getLiveCount();
+
         private:
             void createVertexBuffers(const std::vector<Vertex> &vertices);
             void createIndexBuffers(const std::vector<uint32_t> &indices);
@@ -77,4 +89,7 @@ namespace aurora {
             
             bool isDynamicModel = false;
     };
+
+    static_assert(sizeof(AuroraModel::InstanceData) == 32, "InstanceData layout must match shader.vert");
+    static_assert(sizeof(AuroraModel::Vertex) == 16, "Vertex layout must match shader.vert");
 }
\ No newline at end of file
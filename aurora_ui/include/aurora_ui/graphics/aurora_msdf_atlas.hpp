@@ -13,6 +13,7 @@
 #include <string>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 namespace aurora {
     class AuroraMSDFAtlas {
@@ -20,7 +21,15 @@ namespace aurora {
             struct Config {
                 uint32_t width = 1024;
                 uint32_t height = 1024;
+                bool useCache = true;
+                // Defaults to the font path with CACHE_EXTENSION appended
+                std::string cachePath{};
             };
+
+            static constexpr uint32_t CACHE_VERSION = 1;
+            static constexpr const char* CACHE_EXTENSION = ".msdfcache";
+            static constexpr double PIXEL_RANGE = 4.0;
+            static constexpr double MINIMUM_SCALE = 96.0;
             
             AuroraMSDFAtlas(AuroraDevice& device, const std::string& fontPath);
             AuroraMSDFAtlas(AuroraDevice& device, const std::string& fontPath, const Config& config);
@@ -51,9 +60,21 @@ namespace aurora {
             bool getGlyphInfo(char character, GlyphInfo& glyphInfo) const;
             double getKerning(char left, char right) const;
 
-            const BufferAllocation& getSharedIndexAllocation();
-
         private:
+            struct CacheKey {
+                uint64_t fontHash;
+                uint64_t charsetHash;
+                double pixelRange;
+                double minimumScale;
+            };
+
+            static bool computeCacheKey(const std::string& fontPath, CacheKey& key);
+            bool loadCachedAtlas(const std::string& cachePath, const CacheKey& key);
+            void writeCachedAtlas(const std::string& cachePath, const CacheKey& key, const std::vector<uint8_t>& rgbaData) const;
+
+            std::vector<uint8_t> expandToRGBA() const;
+            void uploadPixels(const void* rgbaData, VkDeviceSize size);
+
             void createAtlasTexture();
             void buildGlyphCache();
             void buildKerningCache();
@@ -72,13 +93,9 @@ namespace aurora {
             std::vector<msdf_atlas::GlyphGeometry> glyphGeometry;
             msdf_atlas::FontGeometry fontGeometry;
 
-            mutable std::unordered_map<char, const msdf_atlas::GlyphGeometry*> glyphCache;
+            std::unordered_map<char, GlyphInfo> glyphCache;
             mutable std::unordered_map<uint64_t, double> kerningCache;
 
-            BufferAllocation sharedIndexAllocation{};
-            static constexpr size_t MAX_TEXT_CHARS = 16384;
-            void ensureSharedIndexBuffer();
-
             void freeFont();
     };
 }
\ No newline at end of file
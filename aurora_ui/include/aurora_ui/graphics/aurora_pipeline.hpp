@@ -19,6 +19,8 @@ namespace aurora {
         VkPipelineDepthStencilStateCreateInfo depthStencilInfo;
         std::vector<VkDynamicState> dynamicStateEnables;
         VkPipelineDynamicStateCreateInfo dynamicStateInfo;
+        std::vector<VkVertexInputBindingDescription> bindingDescriptions{};
+        std::vector<VkVertexInputAttributeDescription> attributeDescriptions{};
         VkPipelineLayout pipelineLayout = nullptr;
         VkRenderPass renderPass = nullptr;
         uint32_t subpass = 0;
@@ -37,14 +39,9 @@ namespace aurora {
             static void defaultPipelineConfigInfo(PipelineConfigInfo& configInfo, VkPrimitiveTopology topology, VkSampleCountFlagBits msaaSamples);
 
         private:
-            static std::vector<char> readFile(const std::string& filePath);
             void createGraphicsPipeline(const std::string& vertFilePath, const std::string& fragFilePath, const PipelineConfigInfo& configInfo);
 
-            void createShaderModule(const std::vector<char>& code, VkShaderModule* shaderModule);
-
             AuroraDevice& auroraDevice;
             VkPipeline graphicsPipeline;
-            VkShaderModule vertShaderModule;
-            VkShaderModule fragShaderModule;
     };
 }
\ No newline at end of file
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <string_view>
+
+namespace aurora {
+    using PipelineKey = uint64_t;
+
+    // Which per-instance vertex layout the pipeline reads
+    enum class InstancingMode : uint8_t {
+        MODEL,
+        GLYPH,
+        SHAPE,
+    };
+
+    enum class BlendMode : uint8_t {
+        NONE,
+        ALPHA,
+        ADDITIVE,
+    };
+
+    enum class DepthMode : uint8_t {
+        READ_WRITE,
+        READ_ONLY,
+        DISABLED,
+    };
+
+    // Everything a render system's pipeline is built from. Component types declare one as a
+    // constexpr constant, so its key is hashed at compile time and finding the render system for a
+    // component is a single hash lookup:
+    //
+    //     static constexpr PipelineDescriptor PIPELINE = PipelineDescriptor{"shaders/shape.vert.spv", "shaders/shape.frag.spv"}
+    //         .withInstancing(InstancingMode::SHAPE);
+    //
+    // Shader paths must outlive the descriptor; string literals are the intended use.
+    class PipelineDescriptor {
+        public:
+            constexpr PipelineDescriptor(std::string_view vertexShaderPath, std::string_view fragmentShaderPath,
+                VkPrimitiveTopology topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST, InstancingMode instancing = InstancingMode::MODEL,
+                BlendMode blend = BlendMode::ALPHA, DepthMode depth = DepthMode::READ_WRITE, bool textureBinding = false)
+                : vertexShaderPath{vertexShaderPath}, fragmentShaderPath{fragmentShaderPath}, topology{topology},
+                  instancing{instancing}, blend{blend}, depth{depth}, textureBinding{textureBinding}, key{computeKey()} {}
+
+            constexpr PipelineDescriptor withTopology(VkPrimitiveTopology value) const {
+                return {vertexShaderPath, fragmentShaderPath, value, instancing, blend, depth, textureBinding};
+            }
+
+            constexpr PipelineDescriptor withInstancing(InstancingMode value) const {
+                return {vertexShaderPath, fragmentShaderPath, topology, value, blend, depth, textureBinding};
+            }
+
+            constexpr PipelineDescriptor withBlend(BlendMode value) const {
+                return {vertexShaderPath, fragmentShaderPath, topology, instancing, value, depth, textureBinding};
+            }
+
+            constexpr PipelineDescriptor withDepth(DepthMode value) const {
+                return {vertexShaderPath, fragmentShaderPath, topology, instancing, blend, value, textureBinding};
+            }
+
+            // Binds the MSDF atlas at set 0, binding 0
+            constexpr PipelineDescriptor withTextureBinding() const {
+                return {vertexShaderPath, fragmentShaderPath, topology, instancing, blend, depth, true};
+            }
+
+            constexpr std::string_view getVertexShaderPath() const { return vertexShaderPath; }
+            constexpr std::string_view getFragmentShaderPath() const { return fragmentShaderPath; }
+            constexpr VkPrimitiveTopology getTopology() const { return topology; }
+            constexpr InstancingMode getInstancing() const { return instancing; }
+            constexpr BlendMode getBlend() const { return blend; }
+            constexpr DepthMode getDepth() const { return depth; }
+            constexpr bool needsTextureBinding() const { return textureBinding; }
+
+            // Pipelines that do not write depth are drawn after the ones that do
+            constexpr bool isTransparent() const { return depth != DepthMode::READ_WRITE; }
+
+            constexpr PipelineKey getKey() const { return key; }
+
+            constexpr bool operator==(const PipelineDescriptor& other) const {
+                return key == other.key &&
+                       vertexShaderPath == other.vertexShaderPath &&
+                       fragmentShaderPath == other.fragmentShaderPath &&
+                       topology == other.topology &&
+                       instancing == other.instancing &&
+                       blend == other.blend &&
+                       depth == other.depth &&
+                       textureBinding == other.textureBinding;
+            }
+
+            constexpr bool operator!=(const PipelineDescriptor& other) const { return !(*this == other); }
+
+        private:
+            // FNV-1a over both paths and the packed state
+            constexpr PipelineKey computeKey() const {
+                PipelineKey hash = 14695981039346656037ull;
+                auto mix = [&hash](uint8_t byte) {
+                    hash ^= byte;
+                    hash *= 1099511628211ull;
+                };
+
+                for (char c : vertexShaderPath) mix(static_cast<uint8_t>(c));
+                // Keeps ("ab", "c") apart from ("a", "bc")
+                mix(0);
+                for (char c : fragmentShaderPath) mix(static_cast<uint8_t>(c));
+                mix(0);
+
+                uint32_t state = static_cast<uint32_t>(topology);
+                for (int i = 0; i < 4; ++i) mix(static_cast<uint8_t>(state >> (i * 8)));
+                mix(static_cast<uint8_t>(instancing));
+                mix(static_cast<uint8_t>(blend));
+                mix(static_cast<uint8_t>(depth));
+                mix(textureBinding ? 1 : 0);
+                return hash;
+            }
+
+            std::string_view vertexShaderPath;
+            std::string_view fragmentShaderPath;
+            VkPrimitiveTopology topology;
+            InstancingMode instancing;
+            BlendMode blend;
+            DepthMode depth;
+            bool textureBinding;
+            PipelineKey key;
+    };
+}
@@ -1,17 +1,20 @@
 #pragma once
 
 #include "aurora_pipeline.hpp"
+#include "aurora_pipeline_key.hpp"
 #include "aurora_engine/core/aurora_device.hpp"
 #include "aurora_engine/core/aurora_camera.hpp"
 #include "aurora_engine/core/aurora_descriptors.hpp"
 #include "aurora_engine/core/aurora_buffer_pool.hpp"
+#include "aurora_engine/core/aurora_instance_store.hpp"
 #include "aurora_ui/graphics/aurora_msdf_atlas.hpp"
 #include "aurora_ui/graphics/aurora_model.hpp"
+#include "aurora_ui/graphics/aurora_glyph_instance.hpp"
+#include "aurora_ui/graphics/aurora_shape_instance.hpp"
 
 #include <memory>
 #include <vector>
 #include <unordered_map>
-#include <map>
 
 #define GLM_FORCE_RADIANS
 #define GLM_FORCE_DEPTH_ZERO_TO_ONE
@@ -29,13 +32,9 @@ namespace aurora {
 namespace aurora {
     struct RenderSystemCreateInfo {
         VkRenderPass renderPass;
-        const std::string& vertFilePath;
-        const std::string& fragFilePath;
-        VkPrimitiveTopology topology;
+        const PipelineDescriptor& pipeline;
         AuroraDescriptorPool* descriptorPool;
         AuroraMSDFAtlas* msdfAtlas;
-        bool needsTextureBinding;
-        bool isTransparent;
     };
 
     class AuroraRenderSystem {
@@ -48,29 +47,52 @@ namespace aurora {
 
             void renderComponents(VkCommandBuffer commandBuffer, const AuroraCamera& camera, int frameIndex);
 
+            // Recreates the pipeline against a new render pass, e.g. after the MSAA sample count changed
+            void rebuildPipeline(VkRenderPass renderPass);
+
             void addComponent(std::shared_ptr<AuroraComponentInterface> component);
-            void removeComponent(std::shared_ptr<AuroraComponentInterface> component);
+            // Swap-removes the component through the slot it was given by addComponent
+            void removeComponent(AuroraComponentInterface& component);
+
+            // Queues the component's instance range to be rewritten before the next recording
+            void markInstancesChanged(const AuroraComponentInterface& component);
             
             size_t getComponentCount() const {
                 return components.size();
             }
+
+            // The manager reports the components in view each time the view or the scene moved;
+            // only those are laid out and drawn
+            void beginVisibilityUpdate() { nextVisibleComponents.clear(); }
+            void addVisibleComponent(AuroraComponentInterface* component) { nextVisibleComponents.push_back(component); }
+            void endVisibilityUpdate();
+
+            size_t getVisibleCount() const { return visibleComponents.size(); }
             
             const std::vector<std::shared_ptr<AuroraComponentInterface>>& getComponents() const {
                 return components;
             }
             
-            bool isCompatibleWith(const AuroraComponentInterface& component) const;
-            bool isTransparent() const { return transparent; }
-            
-            
+            const PipelineDescriptor& getPipeline() const { return pipeline; }
+            PipelineKey getPipelineKey() const { return pipeline.getKey(); }
+            bool isTransparent() const { return pipeline.isTransparent(); }
+
             const std::string& getVertexShaderPath() const { return vertexShaderPath; }
             const std::string& getFragmentShaderPath() const { return fragmentShaderPath; }
-            VkPrimitiveTopology getTopology() const { return topology; }
+            const std::string& getGpuZoneName() const { return gpuZoneName; }
             
         private:
             void createPipelineLayout();
-            void createPipeline(VkRenderPass renderPass, const std::string& vertFilePath, const std::string& fragFilePath, VkPrimitiveTopology topology);
+            void createPipeline(VkRenderPass renderPass);
             void createComponentDescriptorSets(size_t componentIndex, AuroraMSDFAtlas* msdfAtlas);
+            void renderModels(VkCommandBuffer commandBuffer, int frameIndex);
+            // Glyphs and shapes: one quad per instance, all drawn by a single call
+            void renderInstancedQuads(VkCommandBuffer commandBuffer, int frameIndex, const char* instanceCounter);
+
+            void updateInstances();
+            void rebuildInstanceLayout();
+            bool rewriteInstances(uint32_t range);
+            const void* gatherInstances(const AuroraComponentInterface& component, uint32_t& count);
 
             AuroraDevice& auroraDevice;
 
@@ -85,14 +107,41 @@ namespace aurora {
             AuroraMSDFAtlas* msdfAtlas;
 
             std::vector<std::shared_ptr<AuroraComponentInterface>> components;
+            std::vector<AuroraComponentInterface*> visibleComponents;
+            std::vector<AuroraComponentInterface*> nextVisibleComponents;
             
-            std::map<int, std::vector<BufferAllocation>> frameInstanceAllocations;
-            std::unordered_map<AuroraModel*, std::vector<AuroraModel::InstanceData>> batches;
+            // What a range was laid out for; a change to any of it needs a new layout
+            struct LayoutEntry {
+                AuroraComponentInterface* component;
+                AuroraModel* model;
+                float depth;
+            };
+
+            struct ModelBatch {
+                AuroraModel* model;
+                uint32_t firstInstance;
+                uint32_t instanceCount;
+            };
+
+            // One range per component in draw order: grouped by model, or back to front for shapes and glyphs
+            std::unique_ptr<AuroraInstanceStore> instanceStore;
+            std::vector<LayoutEntry> layout;
+            std::vector<ModelBatch> modelBatches;
+            std::vector<uint32_t> changedRanges;
+            std::vector<uint8_t> rangeChanged;
+            bool layoutDirty = true;
+
+            // Scratch for gathering the instances of one component
+            std::vector<AuroraModel::InstanceData> modelInstances;
+            std::vector<GlyphInstance> glyphInstances;
+            std::vector<ShapeInstance> shapeInstances;
             
+            PipelineDescriptor pipeline;
             std::string vertexShaderPath;
             std::string fragmentShaderPath;
-            VkPrimitiveTopology topology;
+            std::string gpuZoneName;
             bool needsTextureBinding;
-            bool transparent;
+            bool glyphInstanced;
+            bool shapeInstanced;
     };
 }
\ No newline at end of file
@@ -6,8 +6,12 @@
 #include "aurora_engine/core/aurora_camera.hpp"
 #include "aurora_engine/core/aurora_descriptors.hpp"
 #include "aurora_ui/graphics/aurora_msdf_atlas.hpp"
+#include "aurora_ui/graphics/aurora_scene_store.hpp"
+#include "aurora_ui/graphics/aurora_geometry_cache.hpp"
 
+#include <atomic>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace aurora {
@@ -20,6 +24,9 @@ namespace aurora {
             AuroraRenderSystemManager(const AuroraRenderSystemManager&) = delete;
             AuroraRenderSystemManager &operator=(const AuroraRenderSystemManager&) = delete;
 
+            // Records the render systems into secondary command buffers as jobs and executes them in
+            // draw order; the render pass must have been begun with
+            // VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS
             void renderAllComponents(VkCommandBuffer commandBuffer, const AuroraCamera& camera);
 
             size_t getRenderSystemCount() const {
@@ -31,32 +38,109 @@ namespace aurora {
             AuroraMSDFAtlas& getMSDFAtlas() { return *msdfAtlas; }
             const AuroraMSDFAtlas& getMSDFAtlas() const { return *msdfAtlas; }
 
-            void addComponentToQueue(std::shared_ptr<AuroraComponentInterface> component) {
-                componentQueue.push_back(component);
-                components.push_back(component);
-            }
+            void addComponentToQueue(std::shared_ptr<AuroraComponentInterface> component);
 
+            // Detaches the component and all its descendants: unlinks it from its parent and removes
+            // every one of them from its render system in constant time
             void removeComponent(std::shared_ptr<AuroraComponentInterface> component);
 
+            // The component's prepareRender() runs before each frame until it unregisters
+            void registerPreRender(AuroraComponentInterface* component);
+            void unregisterPreRender(AuroraComponentInterface* component);
+
+            // Set whenever something visible changes; the render loop skips frames while clean
+            void markDirty() { sceneDirty.store(true, std::memory_order_relaxed); }
+            void clearDirty() { sceneDirty.store(false, std::memory_order_relaxed); }
+            bool isDirty() const { return sceneDirty.load(std::memory_order_relaxed); }
+
+            // Transforms, colors and visibility of every component
+            AuroraSceneStore& getSceneStore() { return sceneStore; }
+
+            // Rendered, non-hidden component under the point that is drawn on top, or null
+            AuroraComponentInterface* pickComponent(glm::vec2 point) { return sceneStore.pick(point); }
+            // Every rendered, non-hidden component whose bounds overlap the rect (min.x, min.y, max.x,
+            // max.y); components without bounds are always included
+            void queryComponents(const glm::vec4& rect, std::vector<AuroraComponentInterface*>& out) { sceneStore.queryRendered(rect, out); }
+
+            // Shared models for components with identical geometry
+            AuroraGeometryCache& getGeometryCache() { return geometryCache; }
+
+            // Creates the render systems for these pipelines up front, in parallel, instead of one at
+            // a time on the frame that first uses them. Pipelines that already have one are skipped.
+            void warmUpPipelines(const std::vector<PipelineDescriptor>& pipelines);
+
         private:
             AuroraRenderSystem* findCompatibleRenderSystem(const AuroraComponentInterface& component);
 
-            std::unique_ptr<AuroraRenderSystem> createRenderSystem(const AuroraComponentInterface& component);
+            std::unique_ptr<AuroraRenderSystem> createRenderSystem(const PipelineDescriptor& pipeline);
             
             void addComponentToRenderSystems(std::shared_ptr<AuroraComponentInterface> component);
 
+            void rebuildPipelines();
+
+            // Each chunk is a contiguous run of render systems recorded by one job into the secondary
+            // command buffers of the recording slot with the same index
+            struct RecordingChunk {
+                size_t begin;
+                size_t end;
+                VkCommandBuffer commandBuffer;
+            };
+
+            void buildRecordingChunks();
+            void recordChunk(uint32_t chunkIndex);
+
             void recalculateAllDepths(std::vector<std::shared_ptr<AuroraComponentInterface>>& components, float& depth, float depthIncrement);
 
+            // Hands every render system the components within the camera's view
+            void cullRenderSystems(const AuroraCamera& camera);
+
+            void detachSubtree(AuroraComponentInterface& component);
+            void compactComponents();
+
             AuroraDevice& auroraDevice;
             AuroraRenderer& auroraRenderer;
-            std::vector<std::unique_ptr<AuroraRenderSystem>> renderSystems;
-            
+
+            // Declared first so it outlives every component the manager or its systems still hold
+            AuroraSceneStore sceneStore;
+            AuroraGeometryCache geometryCache;
+            std::vector<AuroraComponentInterface*> preRenderComponents;
+
             std::unique_ptr<AuroraDescriptorPool> globalDescriptorPool;
             std::unique_ptr<AuroraMSDFAtlas> msdfAtlas;
 
+            // Declared after the pool so render systems release their descriptor sets first
+            std::vector<std::unique_ptr<AuroraRenderSystem>> renderSystems;
+            std::unordered_map<PipelineKey, AuroraRenderSystem*> renderSystemsByKey;
+
+            // Removed components leave a null slot so depth order is kept; compacted once half are empty
             std::vector<std::shared_ptr<AuroraComponentInterface>> components;
+            size_t removedComponentSlots = 0;
             std::vector<std::shared_ptr<AuroraComponentInterface>> componentQueue;
 
+            std::atomic<bool> sceneDirty{true};
+
+            // What the visible lists were last built for; set when components are added or removed
+            std::vector<AuroraComponentInterface*> visibleComponents;
+            glm::vec4 cullBounds{0.0f};
+            uint64_t cullVersion = UINT64_MAX;
+            bool cullDirty = true;
+
+            // Sample count the render system pipelines were built for
+            VkSampleCountFlagBits pipelineSamples;
+
+            // Opaque systems first, then transparent ones, in creation order
+            std::vector<AuroraRenderSystem*> orderedSystems;
+            std::vector<RecordingChunk> recordingChunks;
+            std::vector<VkCommandBuffer> secondaryCommandBuffers;
+            const AuroraCamera* recordingCamera = nullptr;
+            int recordingFrameIndex = 0;
+
+            // Below this many components a single thread records everything
+            static constexpr size_t PARALLEL_RECORDING_THRESHOLD = 256;
+
+            // Covers the antialiased pixel shapes draw past their bounds
+            static constexpr float CULL_MARGIN = 2.0f;
+
             static constexpr float MAX_DEPTH = 0.9999f;
             static constexpr float DEPTH_INCREMENT = 0.0001f;
     };
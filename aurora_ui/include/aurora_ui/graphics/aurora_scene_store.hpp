@@ -0,0 +1,142 @@
+#pragma once
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "aurora_ui/graphics/aurora_spatial_index.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace aurora {
+    class AuroraComponentInterface;
+
+    struct TransformComponent {
+        glm::vec3 translation{};
+        glm::vec2 scale{1.f, 1.f};
+        float rotation = 0.0f;
+
+        glm::mat4 mat4() const {
+            glm::mat4 transform = glm::mat4(1.0f);
+            transform = glm::translate(transform, translation);
+            transform = glm::rotate(transform, rotation, glm::vec3(0.0f, 0.0f, 1.0f));
+            transform = glm::scale(transform, glm::vec3(scale.x, scale.y, 1.0f));
+            return transform;
+        }
+    };
+
+    // Scene state of every component in flat parallel arrays. Nodes are kept in depth-first order,
+    // so parents come before their children and every root's subtree is one contiguous range;
+    // resolving transforms is a forward sweep over the ranges of the roots that changed, and those
+    // ranges are independent, so large updates are split across the job system. Components hold a
+    // stable NodeId, the dense position behind it changes whenever the hierarchy is reordered.
+    // World-space bounds are derived by the same sweep and kept in a spatial index for culling
+    // and picking.
+    class AuroraSceneStore {
+        public:
+            using NodeId = uint32_t;
+            static constexpr NodeId INVALID_NODE = UINT32_MAX;
+
+            AuroraSceneStore() = default;
+
+            AuroraSceneStore(const AuroraSceneStore&) = delete;
+            AuroraSceneStore& operator=(const AuroraSceneStore&) = delete;
+
+            // The owner is told through markDirty() whenever its world transform changes; may be null
+            NodeId createNode(AuroraComponentInterface* owner);
+            void destroyNode(NodeId node);
+            void setParent(NodeId node, NodeId parent);
+
+            const TransformComponent& getLocalTransform(NodeId node) const { return localTransforms[denseIndices[node]]; }
+            // Flags the node so the next update recomputes its subtree
+            void setLocalTransform(NodeId node, const TransformComponent& transform);
+
+            // Resolves the node's subtree first if it has a pending change
+            const glm::mat4& getWorldTransform(NodeId node);
+
+            const glm::vec4& getColor(NodeId node) const { return colors[denseIndices[node]]; }
+            void setColor(NodeId node, const glm::vec4& color) { colors[denseIndices[node]] = color; }
+
+            bool isHidden(NodeId node) const { return flags[denseIndices[node]] & FLAG_HIDDEN; }
+            void setHidden(NodeId node, bool hidden);
+
+            // Local-space rect covering everything the node draws. Nodes start unbounded and are
+            // then never culled.
+            void setLocalBounds(NodeId node, glm::vec2 min, glm::vec2 max);
+            void clearLocalBounds(NodeId node);
+
+            // Owners of every node overlapping the rect (min.x, min.y, max.x, max.y), unbounded ones included
+            void queryRect(const glm::vec4& rect, std::vector<AuroraComponentInterface*>& out);
+            // Same, limited to rendered, non-hidden owners as pick() is
+            void queryRendered(const glm::vec4& rect, std::vector<AuroraComponentInterface*>& out);
+            // Rendered, non-hidden owner at the point with the nearest depth, or null
+            AuroraComponentInterface* pick(glm::vec2 point);
+
+            const AuroraSpatialIndex& getSpatialIndex() const { return spatialIndex; }
+
+            // Recomputes every pending world transform and notifies the owners that changed
+            void updateTransforms();
+            bool hasPendingTransforms() const { return hierarchyDirty || !pendingRoots.empty(); }
+
+            size_t getNodeCount() const { return owners.size() - freedNodes.size(); }
+
+        private:
+            enum : uint8_t {
+                FLAG_HIDDEN = 1 << 0,
+                FLAG_FREE = 1 << 1,
+                // Local transform or parent changed since the last sweep
+                FLAG_DIRTY = 1 << 2,
+                // World transform was recomputed by the current sweep, children follow
+                FLAG_CHANGED = 1 << 3,
+                // Root whose range is queued in pendingRoots
+                FLAG_PENDING = 1 << 4,
+                // Has local bounds, so its world bounds are indexed
+                FLAG_BOUNDED = 1 << 5,
+            };
+
+            struct SweepChunk {
+                size_t beginRoot;
+                size_t endRoot;
+                std::vector<uint32_t> changed;
+            };
+
+            void markTransformDirty(uint32_t index);
+            void reorder();
+            void sweep(uint32_t begin, uint32_t end, std::vector<uint32_t>& changed);
+            void notifyChanged(const std::vector<uint32_t>& changed);
+            bool isPickable(uint32_t index) const;
+
+            // Dense arrays, indexed by position in depth-first order
+            std::vector<TransformComponent> localTransforms;
+            std::vector<glm::mat4> worldTransforms;
+            std::vector<glm::vec4> localBounds;
+            std::vector<glm::vec4> worldBounds;
+            std::vector<glm::vec4> colors;
+            std::vector<uint8_t> flags;
+            std::vector<uint32_t> parents;      // dense index of the parent, or UINT32_MAX for roots
+            std::vector<uint32_t> roots;        // dense index of the root of each node's subtree
+            std::vector<uint32_t> subtreeEnds;  // one past the last node of each node's subtree
+            std::vector<NodeId> nodeIds;
+            std::vector<AuroraComponentInterface*> owners;
+
+            // Source of truth for the hierarchy, indexed by NodeId; dense parents are rebuilt from it
+            std::vector<NodeId> parentIds;
+            std::vector<uint32_t> denseIndices;
+            std::vector<NodeId> freeIds;
+            std::vector<NodeId> freedNodes;
+
+            std::vector<uint32_t> pendingRoots;
+            bool hierarchyDirty = false;
+
+            std::vector<SweepChunk> sweepChunks;
+            std::vector<uint32_t> changedNodes;
+
+            AuroraSpatialIndex spatialIndex;
+            std::vector<AuroraSpatialIndex::ItemId> queryResults;
+
+            // Below this many nodes to sweep the calling thread does it alone
+            static constexpr size_t PARALLEL_SWEEP_THRESHOLD = 4096;
+    };
+}
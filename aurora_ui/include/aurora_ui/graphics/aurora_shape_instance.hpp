@@ -0,0 +1,37 @@
+#pragma once
+
+#include "aurora_engine/core/aurora_device.hpp"
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+
+#include <vector>
+
+namespace aurora {
+    // One rounded rectangle evaluated as a signed distance field in shape.frag. The quad is
+    // grown by the shadow blur, and fill, border and shadow are resolved with analytic
+    // antialiasing, so circles, cards and shadows share a single pipeline and draw call.
+    struct ShapeInstance {
+        glm::vec2 position;
+        glm::vec2 size;
+        glm::vec4 cornerRadii; // top-left, top-right, bottom-right, bottom-left
+        float borderWidth;
+        float shadowBlur;
+        float depth;
+        uint32_t fillColor;
+        uint32_t borderColor;
+        uint32_t shadowColor;
+
+        // Places the local rect [offset, offset + size] under the translation and scale of a world
+        // transform; shapes do not rotate. Colors are left transparent.
+        static ShapeInstance fromWorldTransform(const glm::mat4& world, glm::vec2 offset, glm::vec2 size,
+                                                float cornerRadius, float borderWidth = 0.0f, float shadowBlur = 0.0f);
+        static uint32_t packColor(const glm::vec4& color);
+
+        static std::vector<VkVertexInputBindingDescription> getBindingDescriptions();
+        static std::vector<VkVertexInputAttributeDescription> getAttributeDescriptions();
+    };
+
+    static_assert(sizeof(ShapeInstance) == 56, "ShapeInstance layout must match shape.vert");
+}
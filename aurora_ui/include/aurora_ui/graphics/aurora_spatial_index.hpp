@@ -0,0 +1,100 @@
+#pragma once
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace aurora {
+    // Uniform grid over 2D world-space bounds, stored sparsely so the canvas can be unbounded. An item
+    // is listed in every cell its bounds overlap; items spanning too many cells, and unbounded ones,
+    // sit in separate lists scanned by every query. Bounds are packed as (min.x, min.y, max.x, max.y).
+    // Items remember their position in each of their cells, so moving or removing one does not
+    // depend on how crowded the cells are; queries still visit every item of the cells they cover.
+    class AuroraSpatialIndex {
+        public:
+            using ItemId = uint32_t;
+
+            explicit AuroraSpatialIndex(float cellSize = 256.0f);
+
+            AuroraSpatialIndex(const AuroraSpatialIndex&) = delete;
+            AuroraSpatialIndex& operator=(const AuroraSpatialIndex&) = delete;
+
+            // Inserts the item or moves it; only the cells it enters or leaves are touched
+            void insert(ItemId item, const glm::vec4& bounds);
+            // Unbounded items are returned by every rect query and never by point queries
+            void insertUnbounded(ItemId item);
+            void remove(ItemId item);
+
+            // Appends every item overlapping the rect, each once
+            void queryRect(const glm::vec4& rect, std::vector<ItemId>& out) const;
+            // Appends every bounded item containing the point
+            void queryPoint(glm::vec2 point, std::vector<ItemId>& out) const;
+
+            bool contains(ItemId item) const { return item < items.size() && items[item].placement != PLACEMENT_NONE; }
+            const glm::vec4& getBounds(ItemId item) const { return items[item].bounds; }
+
+            // Changes whenever an item is added, removed or moved
+            uint64_t getVersion() const { return version; }
+            size_t getItemCount() const { return itemCount; }
+            size_t getCellCount() const { return cells.size(); }
+            float getCellSize() const { return cellSize; }
+
+        private:
+            enum Placement : uint8_t {
+                PLACEMENT_NONE,
+                PLACEMENT_CELLS,
+                PLACEMENT_LARGE,
+                PLACEMENT_UNBOUNDED,
+            };
+
+            struct CellRange {
+                int32_t minX, minY, maxX, maxY;
+
+                bool operator==(const CellRange& other) const {
+                    return minX == other.minX && minY == other.minY && maxX == other.maxX && maxY == other.maxY;
+                }
+            };
+
+            struct Item {
+                glm::vec4 bounds;
+                CellRange cells;
+                // Position in largeItems or unboundedItems
+                uint32_t listSlot;
+                Placement placement = PLACEMENT_NONE;
+                // Position in each covered cell, row by row over the cell range
+                std::vector<uint32_t> cellSlots;
+            };
+
+            struct CellEntry {
+                ItemId item;
+                // Which of the item's cellSlots points back at this entry
+                uint32_t rangeIndex;
+            };
+
+            CellRange getCellRange(const glm::vec4& bounds) const;
+            static uint64_t cellKey(int32_t x, int32_t y);
+
+            void link(ItemId item);
+            void unlink(ItemId item);
+            void addToList(std::vector<ItemId>& list, ItemId item);
+            void removeFromList(std::vector<ItemId>& list, ItemId item);
+
+            float cellSize;
+            float inverseCellSize;
+
+            std::vector<Item> items;
+            std::unordered_map<uint64_t, std::vector<CellEntry>> cells;
+            std::vector<ItemId> largeItems;
+            std::vector<ItemId> unboundedItems;
+
+            size_t itemCount = 0;
+            uint64_t version = 0;
+
+            // Items covering more cells than this go to largeItems
+            static constexpr int32_t MAX_CELL_SPAN = 64;
+    };
+}
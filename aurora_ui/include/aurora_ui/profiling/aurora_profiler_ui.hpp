@@ -17,20 +17,13 @@ namespace aurora {
         void addTrackedCounter(const char* counterName);
         void update(float deltaTime) override;
         
-        const std::string& getVertexShaderPath() const override {
-            static const std::string vertexPath = "shaders/text.vert.spv";
-            return vertexPath;
-        }
-        
-        const std::string& getFragmentShaderPath() const override {
-            static const std::string fragmentPath = "shaders/text.frag.spv";
-            return fragmentPath;
-        }
-        
-        VkPrimitiveTopology getTopology() const override {
-            return VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        static constexpr PipelineDescriptor PIPELINE = PipelineDescriptor{"shaders/text.vert.spv", "shaders/text.frag.spv"}
+            .withInstancing(InstancingMode::GLYPH);
+
+        const PipelineDescriptor& getPipeline() const override {
+            return PIPELINE;
         }
-        
+
     private:
         AuroraProfiler& profiler_;
         std::vector<std::string> trackedFunctions_;
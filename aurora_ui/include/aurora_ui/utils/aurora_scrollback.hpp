@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace aurora {
+    // Fixed-capacity ring of wrapped text lines. Every slot reserves the maximum line length up
+    // front, so appending overwrites the oldest line in place and memory stays flat. Lines are
+    // addressed by a sequence number that keeps counting past the capacity.
+    class AuroraScrollback {
+        public:
+            AuroraScrollback(size_t capacity, size_t maxLineLength);
+
+            // Wraps at word boundaries, breaking words longer than a line, and starts a new line at
+            // every '\n'. Returns the number of lines appended.
+            size_t append(std::string_view text);
+            void clear();
+
+            // Valid sequence numbers are [getFirstLine(), getEndLine())
+            uint64_t getFirstLine() const { return endLine - lineCount; }
+            uint64_t getEndLine() const { return endLine; }
+            const std::string& getLine(uint64_t sequence) const { return lines[sequence % lines.size()]; }
+
+            size_t getLineCount() const { return lineCount; }
+            size_t getCapacity() const { return lines.size(); }
+            size_t getMaxLineLength() const { return maxLineLength; }
+
+        private:
+            size_t appendParagraph(std::string_view text);
+            std::string& pushLine();
+
+            std::vector<std::string> lines;
+            size_t maxLineLength;
+            size_t lineCount = 0;
+            uint64_t endLine = 0;
+    };
+}
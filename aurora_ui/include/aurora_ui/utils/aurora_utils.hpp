@@ -1,18 +0,0 @@
-#pragma once
-
-#include "aurora_ui/graphics/aurora_model.hpp"
-#include "aurora_ui/utils/aurora_theme_settings.hpp"
-#include <glm/glm.hpp>
-#include <vector>
-
-namespace aurora {
-    namespace AuroraUtils {
-        std::vector<AuroraModel::Vertex> createRoundedRectangleVertices(
-            glm::vec2 size, 
-            float radius, 
-            int numSegments, 
-            float borderOffset = 0.0f,
-            glm::vec4 color = AuroraThemeSettings::get().WHITE
-        );
-    }
-}
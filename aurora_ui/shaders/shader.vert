@@ -1,10 +1,12 @@
 #version 450
 
-layout(location = 0) in vec3 position;
+layout(location = 0) in vec2 position;
 layout(location = 1) in vec4 color;
 layout(location = 2) in vec2 texCoord;
-layout(location = 3) in mat4 instanceModelMatrix;
-layout(location = 7) in vec4 instanceColor;
+layout(location = 3) in vec4 instanceLinear;
+layout(location = 4) in vec2 instanceTranslation;
+layout(location = 5) in float instanceDepth;
+layout(location = 6) in vec4 instanceColor;
 
 layout(location = 0) out vec4 fragColor;
 
@@ -14,7 +16,7 @@ layout(push_constant) uniform PushConstants {
 } pc;
 
 void main() {
-    vec4 worldPosition = instanceModelMatrix * vec4(position, 1.0);
-    gl_Position = pc.projectionViewMatrix * worldPosition;
+    vec2 worldPosition = mat2(instanceLinear.xy, instanceLinear.zw) * position + instanceTranslation;
+    gl_Position = pc.projectionViewMatrix * vec4(worldPosition, instanceDepth, 1.0);
     fragColor = color * instanceColor;
 }
\ No newline at end of file
@@ -0,0 +1,43 @@
+#version 450
+
+layout(location = 0) in vec2 fragLocalPosition;
+layout(location = 1) flat in vec2 fragHalfSize;
+layout(location = 2) flat in vec4 fragCornerRadii;
+layout(location = 3) flat in vec2 fragBorderShadow;
+layout(location = 4) flat in vec4 fragFillColor;
+layout(location = 5) flat in vec4 fragBorderColor;
+layout(location = 6) flat in vec4 fragShadowColor;
+
+layout(location = 0) out vec4 outColor;
+
+// Signed distance to a rounded box centred on the origin, y pointing down
+float roundedBoxDistance(vec2 p, vec2 halfSize, vec4 radii) {
+    float radius = p.x < 0.0 ? (p.y < 0.0 ? radii.x : radii.w) : (p.y < 0.0 ? radii.y : radii.z);
+    radius = min(radius, min(halfSize.x, halfSize.y));
+
+    vec2 q = abs(p) - halfSize + radius;
+    return min(max(q.x, q.y), 0.0) + length(max(q, 0.0)) - radius;
+}
+
+void main() {
+    float borderWidth = fragBorderShadow.x;
+    float shadowBlur = fragBorderShadow.y;
+
+    float dist = roundedBoxDistance(fragLocalPosition, fragHalfSize, fragCornerRadii);
+    float pixel = max(fwidth(dist), 1e-4);
+
+    float outer = clamp(0.5 - dist / pixel, 0.0, 1.0);
+    float inner = borderWidth > 0.0 ? clamp(0.5 - (dist + borderWidth) / pixel, 0.0, 1.0) : outer;
+    float shadow = shadowBlur > 0.0 ? fragShadowColor.a * clamp(1.0 - dist / shadowBlur, 0.0, 1.0) * (1.0 - outer) : 0.0;
+
+    // Fill, border and shadow cover disjoint regions, so their premultiplied colors add up
+    vec4 color = vec4(fragFillColor.rgb * fragFillColor.a, fragFillColor.a) * inner
+               + vec4(fragBorderColor.rgb * fragBorderColor.a, fragBorderColor.a) * (outer - inner)
+               + vec4(fragShadowColor.rgb * shadow, shadow);
+
+    if (color.a < 0.005) {
+        discard;
+    }
+
+    outColor = vec4(color.rgb / color.a, color.a);
+}
@@ -0,0 +1,47 @@
+#version 450
+
+layout(location = 0) in vec2 shapePosition;
+layout(location = 1) in vec2 shapeSize;
+layout(location = 2) in vec4 shapeCornerRadii;
+layout(location = 3) in float shapeBorderWidth;
+layout(location = 4) in float shapeShadowBlur;
+layout(location = 5) in float shapeDepth;
+layout(location = 6) in vec4 shapeFillColor;
+layout(location = 7) in vec4 shapeBorderColor;
+layout(location = 8) in vec4 shapeShadowColor;
+
+layout(location = 0) out vec2 fragLocalPosition;
+layout(location = 1) flat out vec2 fragHalfSize;
+layout(location = 2) flat out vec4 fragCornerRadii;
+layout(location = 3) flat out vec2 fragBorderShadow;
+layout(location = 4) flat out vec4 fragFillColor;
+layout(location = 5) flat out vec4 fragBorderColor;
+layout(location = 6) flat out vec4 fragShadowColor;
+
+layout(push_constant) uniform PushConstants {
+    mat4 projectionViewMatrix;
+} pc;
+
+const vec2 corners[6] = vec2[](
+    vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(1.0, 1.0),
+    vec2(1.0, 1.0), vec2(0.0, 1.0), vec2(0.0, 0.0)
+);
+
+void main() {
+    vec2 corner = corners[gl_VertexIndex];
+    vec2 halfSize = shapeSize * 0.5;
+
+    // Grow the quad to fit the shadow plus one pixel for the antialiased edge
+    vec2 extent = halfSize + vec2(shapeShadowBlur + 1.0);
+    vec2 localPosition = (corner * 2.0 - 1.0) * extent;
+
+    gl_Position = pc.projectionViewMatrix * vec4(shapePosition + halfSize + localPosition, shapeDepth, 1.0);
+
+    fragLocalPosition = localPosition;
+    fragHalfSize = halfSize;
+    fragCornerRadii = shapeCornerRadii;
+    fragBorderShadow = vec2(shapeBorderWidth, shapeShadowBlur);
+    fragFillColor = shapeFillColor;
+    fragBorderColor = shapeBorderColor;
+    fragShadowColor = shapeShadowColor;
+}
@@ -1,10 +1,10 @@
 #version 450
 
-layout(location = 0) in vec3 position;
-layout(location = 1) in vec4 color;
-layout(location = 2) in vec2 texCoord;
-layout(location = 3) in mat4 instanceModelMatrix;
-layout(location = 7) in vec4 instanceColor;
+layout(location = 0) in vec2 glyphPosition;
+layout(location = 1) in vec2 glyphSize;
+layout(location = 2) in vec4 glyphUvRect;
+layout(location = 3) in float glyphDepth;
+layout(location = 4) in vec4 glyphColor;
 
 layout(location = 0) out vec4 fragColor;
 layout(location = 1) out vec2 fragTexCoord;
@@ -13,9 +13,17 @@ layout(push_constant) uniform PushConstants {
     mat4 projectionViewMatrix;
 } pc;
 
+const vec2 corners[6] = vec2[](
+    vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(1.0, 1.0),
+    vec2(1.0, 1.0), vec2(0.0, 1.0), vec2(0.0, 0.0)
+);
+
 void main() {
-    vec4 worldPosition = instanceModelMatrix * vec4(position, 1.0);
-    gl_Position = pc.projectionViewMatrix * worldPosition;
-    fragColor = color * instanceColor;
-    fragTexCoord = texCoord;
+    vec2 corner = corners[gl_VertexIndex];
+    vec2 position = glyphPosition + corner * glyphSize;
+
+    gl_Position = pc.projectionViewMatrix * vec4(position, glyphDepth, 1.0);
+    fragColor = glyphColor;
+    // Atlas rows are stored bottom-up
+    fragTexCoord = glyphUvRect.xy + vec2(corner.x, 1.0 - corner.y) * glyphUvRect.zw;
 }
@@ -2,6 +2,18 @@
 #include "aurora_ui/utils/aurora_clock.hpp"
 #include "aurora_ui/utils/aurora_theme_settings.hpp"
 #include "aurora_engine/profiling/aurora_profiler.hpp"
+#include "aurora_engine/core/aurora_job_system.hpp"
+#include "aurora_engine/core/aurora_pipeline_cache.hpp"
+#include "aurora_ui/components/aurora_card.hpp"
+#include "aurora_ui/components/aurora_circle.hpp"
+#include "aurora_ui/components/aurora_panel.hpp"
+#include "aurora_ui/components/aurora_rounded_borders.hpp"
+#include "aurora_ui/components/aurora_rounded_rect.hpp"
+#include "aurora_ui/components/aurora_rounded_shadows.hpp"
+#include "aurora_ui/components/aurora_terminal.hpp"
+#include "aurora_ui/components/aurora_text.hpp"
+#include "aurora_ui/components/aurora_triangle.hpp"
+#include "aurora_ui/profiling/aurora_profiler_ui.hpp"
 
 #define GLM_FORCE_RADIANS
 #define GLM_FORCE_DEPTH_ZERO_TO_ONE
@@ -10,54 +22,163 @@
 #include "aurora_engine/utils/log.hpp"
 
 namespace aurora {
+    namespace {
+        double millisecondsSince(std::chrono::steady_clock::time_point start) {
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+    }
+
     AuroraUI::AuroraUI(const std::string& title)
         : auroraWindow{WIDTH, HEIGHT, title},
           auroraDevice{auroraWindow},
           auroraRenderer{auroraWindow, auroraDevice, AuroraThemeSettings::get().BACKGROUND} {
         log::ui()->info("Initializing Aurora UI");
         renderSystemManager = std::make_unique<AuroraRenderSystemManager>(auroraDevice, auroraRenderer);
+        AuroraProfiler::instance().setStartupTime("Engine Init", millisecondsSince(startupBegin));
         log::ui()->info("Aurora UI ready");
     }
 
     AuroraUI::~AuroraUI() {}
 
+    void AuroraUI::requestRedraw() {
+        renderSystemManager->markDirty();
+        wake();
+    }
+
+    void AuroraUI::setRenderQuality(const RenderQuality& quality) {
+        auroraDevice.setRenderQuality(quality);
+        auroraRenderer.requestSwapChainRecreation();
+        requestRedraw();
+    }
+
+    void AuroraUI::wake() {
+        glfwPostEmptyEvent();
+    }
+
+    std::vector<PipelineDescriptor> AuroraUI::getWarmUpPipelines() const {
+        // Several share a pipeline; the manager builds each distinct one once
+        return {
+            AuroraCard::PIPELINE,
+            AuroraCircle::PIPELINE,
+            AuroraRoundedRectangle::PIPELINE,
+            AuroraRoundedBorders::PIPELINE,
+            AuroraRoundedShadows::PIPELINE,
+            AuroraTriangle::PIPELINE,
+            AuroraPanel::PIPELINE,
+            AuroraTerminal::PIPELINE,
+            AuroraProfilerUI::PIPELINE,
+            AuroraText::PIPELINE,
+        };
+    }
+
+    void AuroraUI::logStartupTimes() {
+        auto& profiler = AuroraProfiler::instance();
+        log::ui()->info("Startup took {:.1f} ms to the first frame: engine init {:.1f} ms, pipeline warm-up {:.1f} ms, setup {:.1f} ms, first frame {:.1f} ms ({} pipeline cache)",
+            profiler.getStartupTime("Time To First Frame"), profiler.getStartupTime("Engine Init"), profiler.getStartupTime("Pipeline Warm-Up"),
+            profiler.getStartupTime("Setup"), profiler.getStartupTime("First Frame"),
+            auroraDevice.getPipelineCache().wasLoadedFromDisk() ? "warm" : "cold");
+    }
+
+    bool AuroraUI::needsRedraw() {
+        return renderSystemManager->isDirty() || auroraWindow.wasWindowResized() || auroraWindow.wasRefreshRequested();
+    }
+
     void AuroraUI::run() {
         AuroraCamera camera;
-        AuroraClock clock(60, true);
+        AuroraClock clock(60, frameRateLimit);
+        bool clockFrameRateLimit = frameRateLimit;
 
         AuroraComponentInfo componentInfo{auroraDevice, *renderSystemManager};
 
         auto& profiler = AuroraProfiler::instance();
         profiler.setEnabled(true);
+        profiler.setThreadName("Main");
 
+        if (pipelineWarmUp) {
+            auto warmUpBegin = std::chrono::steady_clock::now();
+            renderSystemManager->warmUpPipelines(getWarmUpPipelines());
+            profiler.setStartupTime("Pipeline Warm-Up", millisecondsSince(warmUpBegin));
+        }
+
+        auto setupBegin = std::chrono::steady_clock::now();
         onSetup(componentInfo);
+        profiler.setStartupTime("Setup", millisecondsSince(setupBegin));
+
+        bool firstFrame = true;
+        uint64_t skippedSinceLastFrame = 0;
+        auto lastUpdate = std::chrono::steady_clock::now();
 
         while (!auroraWindow.shouldClose()) {
-            clock.beginFrame();
+            bool onDemand = renderMode == RenderMode::OnDemand;
+
+            if (onDemand && !needsRedraw()) {
+                glfwWaitEventsTimeout(IDLE_WAIT_TIMEOUT_SECONDS);
+            } else {
+                glfwPollEvents();
+            }
 
-            glfwPollEvents();
+            if (clockFrameRateLimit != frameRateLimit) {
+                clockFrameRateLimit = frameRateLimit;
+                clock.setFrameRateLimit(frameRateLimit);
+            }
+            clock.beginFrame();
+            profiler.beginFrame();
 
             uint32_t width = auroraRenderer.getWidth();
             uint32_t height = auroraRenderer.getHeight();
 
             camera.setOrthographicProjection(0, width, height, 0, 0, 1);
 
-            onUpdate(static_cast<float>(clock.getFrameTimeMs()) / 1000.f);
+            // The clock's frame time is stale after an idle wait, updates get the real time since the last one
+            auto updateBegin = std::chrono::steady_clock::now();
+            float deltaTime = std::chrono::duration<float>(updateBegin - lastUpdate).count();
+            lastUpdate = updateBegin;
 
+            onUpdate(deltaTime);
+
+            if (onDemand && !needsRedraw()) {
+                skippedFrameCount++;
+                skippedSinceLastFrame++;
+                // Closed here so zones recorded by the update are not added to the next rendered frame
+                profiler.newFrame();
+                continue;
+            }
+
+            // Cleared before recording so changes made while this frame is in flight trigger another
+            renderSystemManager->clearDirty();
+            auroraWindow.resetRefreshRequestedFlag();
+            profiler.setCounter("Skipped Frames", skippedSinceLastFrame);
+            profiler.setCounter("Total Skipped Frames", skippedFrameCount);
+            skippedSinceLastFrame = 0;
+
+            auto frameBegin = std::chrono::steady_clock::now();
             VkCommandBuffer commandBuffer = auroraRenderer.beginFrame();
 
             if (commandBuffer) {
-                auroraRenderer.beginSwapChainRenderPass(commandBuffer);
+                auroraRenderer.beginSwapChainRenderPass(commandBuffer, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
                 renderSystemManager->renderAllComponents(auroraRenderer.getCurrentCommandBuffer(), camera);
                 auroraRenderer.endSwapChainRenderPass(commandBuffer);
                 auroraRenderer.endFrame();
+
+                if (firstFrame) {
+                    firstFrame = false;
+                    profiler.setStartupTime("First Frame", millisecondsSince(frameBegin));
+                    profiler.setStartupTime("Time To First Frame", millisecondsSince(startupBegin));
+                    logStartupTimes();
+
+                    // Every pipeline of the initial scene exists now; saved early so a crash keeps them
+                    auroraDevice.getPipelineCache().save();
+                }
             } else {
                 log::ui()->warn("Failed to begin frame, skipping rendering");
+                renderSystemManager->markDirty();
             }
 
+            // Aggregates this frame's zones before the clock logs them
             profiler.setFrameTime(clock.getFrameTimeMs());
-            clock.endFrame();
+            AuroraJobSystem::instance().publishStatistics();
             profiler.newFrame();
+            clock.endFrame();
         }
 
         vkDeviceWaitIdle(auroraDevice.device());
@@ -1,34 +1,19 @@
 #include "aurora_ui/components/aurora_card.hpp"
 #include "aurora_ui/utils/aurora_theme_settings.hpp"
-#include "aurora_ui/components/aurora_rounded_borders.hpp"
-#include "aurora_ui/components/aurora_rounded_rect.hpp"
-#include "aurora_ui/components/aurora_rounded_shadows.hpp"
-
-#define GLM_FORCE_RADIANS
-#define GLM_FORCE_DEPTH_ZERO_TO_ONE
-#include <glm/gtc/constants.hpp>
-
-#include <memory>
 
 namespace aurora {
     AuroraCard::AuroraCard(AuroraComponentInfo &componentInfo, glm::vec2 size, glm::vec4 borderColor)
         : AuroraComponentInterface{componentInfo}, size{size}, borderColor{borderColor} {
-        initialize();
+        setColor(AuroraThemeSettings::get().DELIMITER);
+        setLocalBounds(glm::vec2(-SHADOW_BLUR), size + SHADOW_BLUR);
     }
 
-    void AuroraCard::initialize() {
-        float radius = 50.0f;
-
-        auto shadowBordersComponent = std::make_shared<AuroraRoundedShadows>(componentInfo, size, radius, 15.0f);
-
-        auto bordersComponent = std::make_shared<AuroraRoundedBorders>(componentInfo, size, radius, 6.0f);
-        bordersComponent->color = borderColor;
-
-        auto roundedRectComponent = std::make_shared<AuroraRoundedRectangle>(componentInfo, size, radius);
-        roundedRectComponent->color = AuroraThemeSettings::get().DELIMITER;
-
-        addChild(shadowBordersComponent);
-        addChild(roundedRectComponent);
-        addChild(bordersComponent);
+    void AuroraCard::appendShapeInstances(std::vector<ShapeInstance>& instances) const {
+        // Shadow, fill and border resolve in one SDF quad
+        ShapeInstance instance = ShapeInstance::fromWorldTransform(getWorldTransform(), glm::vec2(0.0f), size, CORNER_RADIUS, BORDER_WIDTH, SHADOW_BLUR);
+        instance.fillColor = ShapeInstance::packColor(getColor());
+        instance.borderColor = ShapeInstance::packColor(borderColor);
+        instance.shadowColor = ShapeInstance::packColor(AuroraThemeSettings::get().SHADOW_MEDIUM);
+        instances.push_back(instance);
     }
-}
\ No newline at end of file
+}
@@ -2,6 +2,15 @@
 #include "aurora_ui/graphics/aurora_render_system_manager.hpp"
 
 namespace aurora {
+    AuroraComponentInterface::AuroraComponentInterface(AuroraComponentInfo &componentInfo)
+        : componentInfo{componentInfo},
+          scene{componentInfo.renderSystemManager.getSceneStore()},
+          node{scene.createNode(this)} {}
+
+    AuroraComponentInterface::~AuroraComponentInterface() {
+        scene.destroyNode(node);
+    }
+
     void AuroraComponentInterface::addToRenderSystem() {
         componentInfo.renderSystemManager.addComponentToQueue(shared_from_this());
         rendering = true;
@@ -10,4 +19,17 @@ namespace aurora {
             child->addToRenderSystem();
         }
     }
-}
+
+    void AuroraComponentInterface::removeChild(const std::shared_ptr<AuroraComponentInterface>& child) {
+        if (child->parent.lock().get() != this) return;
+        componentInfo.renderSystemManager.removeComponent(child);
+    }
+
+    void AuroraComponentInterface::markDirty() {
+        componentInfo.renderSystemManager.markDirty();
+
+        if (renderSystem) {
+            renderSystem->markInstancesChanged(*this);
+        }
+    }
+}
\ No newline at end of file
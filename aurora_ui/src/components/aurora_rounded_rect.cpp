@@ -1,19 +1,15 @@
 #include "aurora_ui/components/aurora_rounded_rect.hpp"
-#include "aurora_ui/utils/aurora_utils.hpp"
-
-#include <memory>
 
 namespace aurora {
     AuroraRoundedRectangle::AuroraRoundedRectangle(AuroraComponentInfo &componentInfo, glm::vec2 size, float radius)
         : AuroraComponentInterface{componentInfo}, size{size}, radius{radius} {
-        initialize();
+        setLocalBounds(glm::vec2(0.0f), size);
     }
 
-    void AuroraRoundedRectangle::initialize() {
-        std::vector<AuroraModel::Vertex> vertices = AuroraUtils::createRoundedRectangleVertices(size, radius, 16, 0.0f, color);
-        AuroraModel::Builder builder{};
-        builder.vertices = vertices;
-        model = std::make_shared<AuroraModel>(componentInfo.auroraDevice, builder);
+    void AuroraRoundedRectangle::appendShapeInstances(std::vector<ShapeInstance>& instances) const {
+        ShapeInstance instance = ShapeInstance::fromWorldTransform(getWorldTransform(), glm::vec2(0.0f), size, radius);
+        instance.fillColor = ShapeInstance::packColor(getColor());
+        instances.push_back(instance);
     }
 
-}
\ No newline at end of file
+}
@@ -1,31 +1,17 @@
 #include "aurora_ui/components/aurora_rounded_shadows.hpp"
 #include "aurora_ui/utils/aurora_theme_settings.hpp"
-#include "aurora_ui/utils/aurora_utils.hpp"
-
-#include <memory>
 
 namespace aurora {
     AuroraRoundedShadows::AuroraRoundedShadows(AuroraComponentInfo &componentInfo, glm::vec2 size, float radius, float borderWidth)
         : AuroraComponentInterface{componentInfo}, size{size}, radius{radius}, borderWidth{borderWidth} {
-        initialize();
+        setLocalBounds(glm::vec2(-borderWidth), size + borderWidth);
     }
 
-    void AuroraRoundedShadows::initialize() {
-        std::vector<AuroraModel::Vertex> outerVertices = AuroraUtils::createRoundedRectangleVertices(size, radius, 8, -borderWidth, AuroraThemeSettings::get().SHADOW_TRANSPARENT);
-        std::vector<AuroraModel::Vertex> innerVertices = AuroraUtils::createRoundedRectangleVertices(size, radius, 8, 0.0f, AuroraThemeSettings::get().SHADOW_MEDIUM);
-        std::vector<AuroraModel::Vertex> vertices;
-
-        for (size_t i = 0; i < outerVertices.size(); ++i) {
-            vertices.push_back(outerVertices[i]);
-            vertices.push_back(innerVertices[i]);
-        }
-
-        vertices.push_back(outerVertices[0]);
-        vertices.push_back(innerVertices[0]);
-
-        AuroraModel::Builder builder{};
-        builder.vertices = vertices;
-        model = std::make_shared<AuroraModel>(componentInfo.auroraDevice, builder);
+    void AuroraRoundedShadows::appendShapeInstances(std::vector<ShapeInstance>& instances) const {
+        // The shadow fades out over borderWidth outside the rect and leaves the inside empty
+        ShapeInstance instance = ShapeInstance::fromWorldTransform(getWorldTransform(), glm::vec2(0.0f), size, radius, 0.0f, borderWidth);
+        instance.shadowColor = ShapeInstance::packColor(AuroraThemeSettings::get().SHADOW_MEDIUM);
+        instances.push_back(instance);
     }
 
-}
\ No newline at end of file
+}
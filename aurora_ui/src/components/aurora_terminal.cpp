@@ -2,21 +2,29 @@
 #include "aurora_ui/components/aurora_card.hpp"
 #include "aurora_ui/components/aurora_text.hpp"
 #include "aurora_ui/utils/aurora_theme_settings.hpp"
+#include "aurora_ui/graphics/aurora_render_system_manager.hpp"
 
 #define GLM_FORCE_RADIANS
 #define GLM_FORCE_DEPTH_ZERO_TO_ONE
 #include <glm/gtc/constants.hpp>
 
 #include "aurora_engine/utils/log.hpp"
+#include "aurora_engine/profiling/aurora_profiler.hpp"
 
+#include <algorithm>
 #include <memory>
-#include <sstream>
 
 namespace aurora {
-    AuroraTerminal::AuroraTerminal(AuroraComponentInfo &componentInfo, glm::vec2 size, float fontSize, float padding)
-        : AuroraComponentInterface{componentInfo}, size{size}, fontSize{fontSize}, padding{padding} {
+    AuroraTerminal::AuroraTerminal(AuroraComponentInfo &componentInfo, glm::vec2 size, float fontSize, float padding, size_t scrollbackLines)
+        : AuroraComponentInterface{componentInfo}, size{size}, fontSize{fontSize}, padding{padding}, scrollback{1, 1} {
         calculateDimensions();
+        scrollback = AuroraScrollback{std::max<size_t>(scrollbackLines, maxLines), static_cast<size_t>(maxCharsPerLine)};
         initialize();
+        componentInfo.renderSystemManager.registerPreRender(this);
+    }
+
+    AuroraTerminal::~AuroraTerminal() {
+        componentInfo.renderSystemManager.unregisterPreRender(this);
     }
 
     void AuroraTerminal::calculateDimensions() {
@@ -40,89 +48,90 @@ namespace aurora {
         auto cardComponent = std::make_shared<AuroraCard>(componentInfo, size, AuroraThemeSettings::get().PURPLE);
         addChild(cardComponent);
 
-        // auto textComponent = std::make_shared<AuroraText>(componentInfo, "> Hello World !", 15.0f);
-        // textComponent->setPosition(50 * 0.8f, 50 * 0.5f);
+        rows.reserve(maxLines);
+        rowLines.assign(maxLines, UINT64_MAX);
+        for (int i = 0; i < maxLines; ++i) {
+            auto row = std::make_shared<AuroraText>(componentInfo, "", fontSize);
+            row->setHidden(true);
+            addChild(row);
+            rows.push_back(row);
+        }
 
-        
         addText("> Hello World !");
     }
 
-    std::vector<std::string> AuroraTerminal::wrapText(const std::string& text, size_t maxWidth) {
-        std::vector<std::string> wrappedLines;
-        
-        if (text.empty()) {
-            wrappedLines.push_back("");
-            return wrappedLines;
+    void AuroraTerminal::addText(std::string_view text) {
+        size_t appended = scrollback.append(text);
+
+        // Keep a scrolled-up view on the same lines
+        if (scrollOffset > 0) {
+            scrollOffset = std::min(scrollOffset + appended, getMaxScrollOffset());
         }
-        
-        std::istringstream words(text);
-        std::string word;
-        std::string currentLine;
-        
-        while (words >> word) {
-            if (!currentLine.empty() && (currentLine.length() + 1 + word.length()) > maxWidth) {
-                wrappedLines.push_back(currentLine);
-                currentLine = word;
-            } else {
-                if (!currentLine.empty()) {
-                    currentLine += " ";
-                }
-                currentLine += word;
-            }
+
+        displayDirty = true;
+        markDirty();
+    }
+
+    void AuroraTerminal::clear() {
+        scrollback.clear();
+        scrollOffset = 0;
+        displayDirty = true;
+        markDirty();
+    }
+
+    void AuroraTerminal::scrollBy(int lines) {
+        if (lines < 0) {
+            size_t down = static_cast<size_t>(-static_cast<int64_t>(lines));
+            setScrollOffset(scrollOffset > down ? scrollOffset - down : 0);
+        } else {
+            setScrollOffset(scrollOffset + static_cast<size_t>(lines));
         }
-        
-        if (!currentLine.empty()) {
-            wrappedLines.push_back(currentLine);
+    }
+
+    void AuroraTerminal::setScrollOffset(size_t offset) {
+        offset = std::min(offset, getMaxScrollOffset());
+        if (offset != scrollOffset) {
+            scrollOffset = offset;
+            displayDirty = true;
+            markDirty();
         }
-        
-        return wrappedLines;
     }
 
-    void AuroraTerminal::addText(const std::string& text) {
-        // spdlog::info("addText called: '{}', current lines: {}", text, lines.size());
-        
-        std::vector<std::string> newLines = wrapText(text, maxCharsPerLine);
-        // spdlog::info("Text wrapped into {} lines", newLines.size());
+    size_t AuroraTerminal::getMaxScrollOffset() const {
+        size_t visibleLines = static_cast<size_t>(maxLines);
+        return scrollback.getLineCount() > visibleLines ? scrollback.getLineCount() - visibleLines : 0;
+    }
 
-        for (const auto& line : newLines) {
-            lines.push_back(line);
-            // spdlog::info("Added line: '{}'", line);
+    void AuroraTerminal::prepareRender() {
+        if (displayDirty) {
+            refreshDisplay();
         }
-        
-        while (static_cast<int>(lines.size()) > maxLines) {
-            lines.erase(lines.begin());
-        }
-        
-        // spdlog::info("Final line count: {}", lines.size());
-        
-        refreshDisplay();
     }
 
     void AuroraTerminal::refreshDisplay() {
-        // spdlog::info("refreshDisplay called, lines to display: {}", lines.size());
-        
-        auto& children = getChildren();
-        
-        // spdlog::info("Current children count: {}", children.size());
-        
-        if (children.size() > 1) {
-            children.erase(children.begin() + 1, children.end());
-            // spdlog::info("Removed old text components, children count now: {}", children.size());
-        }
-        
-        for (size_t i = 0; i < lines.size(); ++i) {
-            auto textComponent = std::make_shared<AuroraText>(componentInfo, lines[i], fontSize);
-            
-            float x = padding;
-            float y = padding + (i * lineHeight);
-            
-            // spdlog::info("Creating text component {} at position ({}, {}) with text: '{}'", i, x, y, lines[i]);
-            
-            textComponent->setPosition(x, y);
-            // spdlog::info("Adding a terminal text component");
-            addChild(textComponent);
+        AURORA_PROFILE("Terminal Refresh");
+        displayDirty = false;
+
+        const uint64_t endLine = scrollback.getEndLine() - std::min<uint64_t>(scrollOffset, scrollback.getLineCount());
+        const uint64_t firstLine = std::max(scrollback.getFirstLine(), endLine - std::min<uint64_t>(endLine, rows.size()));
+        const size_t visibleCount = static_cast<size_t>(endLine - firstLine);
+
+        // Rows holding the visible lines are a contiguous run modulo the pool size
+        const size_t firstRow = static_cast<size_t>(firstLine % rows.size());
+        for (size_t i = 0; i < rows.size(); ++i) {
+            size_t row = (firstRow + i) % rows.size();
+            if (i >= visibleCount) {
+                rows[row]->setHidden(true);
+                continue;
+            }
+
+            uint64_t line = firstLine + i;
+            if (rowLines[row] != line) {
+                rows[row]->setText(scrollback.getLine(line));
+                rowLines[row] = line;
+            }
+            rows[row]->setPosition(padding, padding + (i * lineHeight));
+            rows[row]->setHidden(false);
         }
-        
-        // spdlog::info("refreshDisplay complete, final children count: {}", getChildren().size());
     }
-}
\ No newline at end of file
+}
@@ -17,7 +17,7 @@ namespace aurora {
     }
 
     void AuroraText::initialize() {
-        color = glm::vec4(1.0f);
+        setColor(glm::vec4(1.0f));
         rebuildGeometry();
     }
 
@@ -48,40 +48,31 @@ namespace aurora {
         cachedFullText.clear();
         for (const auto& seg : segments) cachedFullText += seg.text;
 
-        updateTextVertices();
-
-        AuroraMSDFAtlas& msdfAtlas = componentInfo.renderSystemManager.getMSDFAtlas();
+        layoutGlyphs();
+        setLocalBounds(glm::vec2(0.0f), textBounds);
+        markDirty();
+    }
 
-        if (model && model->isDynamic()) {
-            VkDeviceSize requiredSize = cachedVertices.size() * sizeof(AuroraModel::Vertex);
-            model->resizeVertexBuffer(requiredSize);
-            model->updateVertexData(cachedVertices.data(), requiredSize);
-            model->setVertexCount(static_cast<uint32_t>(cachedVertices.size()));
-            model->setIndexCount(static_cast<uint32_t>(cachedVertices.size() / 4 * 6));
-            return;
+    void AuroraText::appendGlyphInstances(std::vector<GlyphInstance>& instances) const {
+        // Glyphs follow the world translation and scale; text does not rotate
+        const glm::mat4 world = getWorldTransform();
+        const glm::vec2 origin{world[3][0], world[3][1]};
+        const glm::vec2 scale{glm::length(glm::vec2(world[0])), glm::length(glm::vec2(world[1]))};
+        const float depth = world[3][2];
+
+        for (const auto& glyph : glyphs) {
+            instances.push_back({
+                origin + glyph.position * scale,
+                glyph.size * scale,
+                glyph.uvRect,
+                depth,
+                GlyphInstance::packColor(glyph.color * getColor())
+            });
         }
-
-        size_t vertexCapacity = cachedVertices.size() > 0 ? cachedVertices.size() * 2 : 128;
-
-        if (cachedVertices.capacity() < vertexCapacity) cachedVertices.reserve(vertexCapacity);
-
-        AuroraModel::Builder builder{};
-        builder.vertices = cachedVertices;
-        builder.vertices.resize(vertexCapacity);
-
-        builder.sharedIndexAllocation = &msdfAtlas.getSharedIndexAllocation();
-        builder.isDynamic = true;
-
-        model = std::make_shared<AuroraModel>(componentInfo.auroraDevice, builder);
-
-        model->setVertexCount(static_cast<uint32_t>(cachedVertices.size()));
-        model->setIndexCount(static_cast<uint32_t>(cachedVertices.size() / 4 * 6));
-
-        currentVertexCapacity = vertexCapacity;
     }
 
-    void AuroraText::updateTextVertices() {
-        cachedVertices.clear();
+    void AuroraText::layoutGlyphs() {
+        glyphs.clear();
         const AuroraMSDFAtlas& msdfAtlas = componentInfo.renderSystemManager.getMSDFAtlas();
 
         // Build a flat character+color list so kerning works across segment boundaries
@@ -91,7 +82,10 @@ namespace aurora {
             for (char c : seg.text) chars.push_back({c, seg.color});
         }
 
-        if (chars.empty()) return;
+        if (chars.empty()) {
+            textBounds = {0.0f, 0.0f};
+            return;
+        }
 
         glm::vec2 cursor = {0.0f, 0.0f};
         float scale = fontSize / 0.80741f;
@@ -146,21 +140,7 @@ namespace aurora {
                 maxY = std::max(maxY, glyphPos.y + glyphSize.y);
             }
 
-            AuroraModel::Vertex v1(glm::vec3(glyphPos.x, glyphPos.y, 0.0f), charColor);
-            v1.texCoord = glm::vec2(glyphInfo.atlasBounds.x, glyphInfo.atlasBounds.y + glyphInfo.atlasBounds.w);
-            cachedVertices.push_back(v1);
-
-            AuroraModel::Vertex v2(glm::vec3(glyphPos.x + glyphSize.x, glyphPos.y, 0.0f), charColor);
-            v2.texCoord = glm::vec2(glyphInfo.atlasBounds.x + glyphInfo.atlasBounds.z, glyphInfo.atlasBounds.y + glyphInfo.atlasBounds.w);
-            cachedVertices.push_back(v2);
-
-            AuroraModel::Vertex v3(glm::vec3(glyphPos.x + glyphSize.x, glyphPos.y + glyphSize.y, 0.0f), charColor);
-            v3.texCoord = glm::vec2(glyphInfo.atlasBounds.x + glyphInfo.atlasBounds.z, glyphInfo.atlasBounds.y);
-            cachedVertices.push_back(v3);
-
-            AuroraModel::Vertex v4(glm::vec3(glyphPos.x, glyphPos.y + glyphSize.y, 0.0f), charColor);
-            v4.texCoord = glm::vec2(glyphInfo.atlasBounds.x, glyphInfo.atlasBounds.y);
-            cachedVertices.push_back(v4);
+            glyphs.push_back({glyphPos, glyphSize, glyphInfo.atlasBounds, charColor});
 
             cursor.x += static_cast<float>(glyphInfo.advance) * scale;
 
@@ -170,11 +150,8 @@ namespace aurora {
             }
         }
 
-        float offsetX = -minX;
-        float offsetY = -minY;
-        for (auto& vertex : cachedVertices) {
-            vertex.position.x += offsetX;
-            vertex.position.y += offsetY;
+        for (auto& glyph : glyphs) {
+            glyph.position -= glm::vec2(minX, minY);
         }
 
         textBounds = {maxX - minX, maxY - minY};
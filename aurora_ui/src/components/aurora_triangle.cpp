@@ -1,4 +1,5 @@
 #include "aurora_ui/components/aurora_triangle.hpp"
+#include "aurora_ui/graphics/aurora_render_system_manager.hpp"
 
 #include <memory>
 
@@ -8,15 +9,17 @@ namespace aurora {
     }
 
     void AuroraTriangle::initialize() {
-        std::vector<AuroraModel::Vertex> vertices = {
-            {{0.0f, -0.5f, 0.0f}, {1.0f, 0.0f, 0.0f, 1.0f}},
-            {{0.5f, 0.5f, 0.0f}, {0.0f, 1.0f, 0.0f, 1.0f}},
-            {{-0.5f, 0.5f, 0.0f}, {0.0f, 0.0f, 1.0f, 1.0f}}
-        };
-
-        AuroraModel::Builder builder{};
-        builder.vertices = vertices;
-        model = std::make_shared<AuroraModel>(componentInfo.auroraDevice, builder);
-        color = {1.0f, 1.0f, 1.0f, 1.0f};
+        // Every triangle shares one model, so they draw as a single instanced batch
+        model = componentInfo.renderSystemManager.getGeometryCache().acquire({GeometryShape::TRIANGLE}, [] {
+            AuroraModel::Builder builder{};
+            builder.vertices = {
+                {{0.0f, -0.5f, 0.0f}, {1.0f, 0.0f, 0.0f, 1.0f}},
+                {{0.5f, 0.5f, 0.0f}, {0.0f, 1.0f, 0.0f, 1.0f}},
+                {{-0.5f, 0.5f, 0.0f}, {0.0f, 0.0f, 1.0f, 1.0f}}
+            };
+            return builder;
+        });
+        setColor({1.0f, 1.0f, 1.0f, 1.0f});
+        setLocalBounds(glm::vec2(-0.5f), glm::vec2(0.5f));
     }
 }
\ No newline at end of file
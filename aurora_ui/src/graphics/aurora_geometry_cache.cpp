@@ -0,0 +1,48 @@
+#include "aurora_ui/graphics/aurora_geometry_cache.hpp"
+#include "aurora_engine/profiling/aurora_profiler.hpp"
+
+#include <algorithm>
+
+namespace aurora {
+    namespace {
+        void hashCombine(size_t& seed, size_t value) {
+            seed ^= value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+        }
+    }
+
+    size_t GeometryKeyHash::operator()(const GeometryKey& key) const {
+        std::hash<float> hashFloat;
+        size_t seed = std::hash<uint8_t>{}(static_cast<uint8_t>(key.shape));
+        hashCombine(seed, hashFloat(key.size.x));
+        hashCombine(seed, hashFloat(key.size.y));
+        return seed;
+    }
+
+    std::shared_ptr<AuroraModel> AuroraGeometryCache::acquire(const GeometryKey& key, const BuildFunction& build) {
+        auto& entry = models[key];
+        if (auto model = entry.lock()) {
+            AuroraProfiler::instance().incrementCounter("Geometry Cache Hits");
+            return model;
+        }
+
+        auto model = std::make_shared<AuroraModel>(device, build());
+        entry = model;
+        AuroraProfiler::instance().incrementCounter("Geometry Cache Misses");
+
+        if (models.size() >= pruneThreshold) {
+            pruneExpired();
+        }
+        return model;
+    }
+
+    void AuroraGeometryCache::pruneExpired() {
+        for (auto it = models.begin(); it != models.end();) {
+            if (it->second.expired()) {
+                it = models.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        pruneThreshold = std::max<size_t>(64, models.size() * 2);
+    }
+}
@@ -0,0 +1,37 @@
+#include "aurora_ui/graphics/aurora_glyph_instance.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace aurora {
+    uint32_t GlyphInstance::packColor(const glm::vec4& color) {
+        auto channel = [](float value) {
+            return static_cast<uint32_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+        };
+
+        // Byte order matches VK_FORMAT_R8G8B8A8_UNORM on little-endian hosts
+        return channel(color.r) | (channel(color.g) << 8) | (channel(color.b) << 16) | (channel(color.a) << 24);
+    }
+
+    std::vector<VkVertexInputBindingDescription> GlyphInstance::getBindingDescriptions() {
+        std::vector<VkVertexInputBindingDescription> bindingDescriptions(1);
+
+        bindingDescriptions[0].binding = 0;
+        bindingDescriptions[0].stride = sizeof(GlyphInstance);
+        bindingDescriptions[0].inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+
+        return bindingDescriptions;
+    }
+
+    std::vector<VkVertexInputAttributeDescription> GlyphInstance::getAttributeDescriptions() {
+        std::vector<VkVertexInputAttributeDescription> attributeDescriptions{};
+
+        attributeDescriptions.push_back({0, 0, VK_FORMAT_R32G32_SFLOAT, offsetof(GlyphInstance, position)});
+        attributeDescriptions.push_back({1, 0, VK_FORMAT_R32G32_SFLOAT, offsetof(GlyphInstance, size)});
+        attributeDescriptions.push_back({2, 0, VK_FORMAT_R32G32B32A32_SFLOAT, offsetof(GlyphInstance, uvRect)});
+        attributeDescriptions.push_back({3, 0, VK_FORMAT_R32_SFLOAT, offsetof(GlyphInstance, depth)});
+        attributeDescriptions.push_back({4, 0, VK_FORMAT_R8G8B8A8_UNORM, offsetof(GlyphInstance, color)});
+
+        return attributeDescriptions;
+    }
+}
@@ -1,12 +1,44 @@
 #include "aurora_ui/graphics/aurora_model.hpp"
+#include "aurora_ui/graphics/aurora_glyph_instance.hpp"
+#include "aurora_engine/core/aurora_upload_queue.hpp"
+#include "aurora_engine/core/aurora_deletion_queue.hpp"
 
+#include <atomic>
 #include <cassert>
 #include "aurora_engine/utils/log.hpp"
 #include <cstring>
 
 namespace aurora {
+    namespace {
+        std::atomic<uint32_t> liveModelCount{0};
+    }
+
+    AuroraModel::Vertex::Vertex(const glm::vec3& pos, const glm::vec4& col)
+        : position(pos.x, pos.y), color(packColor(col)), texCoord{0, 0} {}
+
+    AuroraModel::Vertex::Vertex(const glm::vec2& pos, const glm::vec4& col)
+        : position(pos), color(packColor(col)), texCoord{0, 0} {}
+
+    AuroraModel::InstanceData AuroraModel::InstanceData::fromWorldTransform(const glm::mat4& world, const glm::vec4& color) {
+        InstanceData instance{};
+        instance.linear = glm::vec4(world[0][0], world[0][1], world[1][0], world[1][1]);
+        instance.translation = glm::vec2(world[3][0], world[3][1]);
+        instance.depth = world[3][2];
+        instance.color = packColor(color);
+        return instance;
+    }
+
+    uint32_t AuroraModel::packColor(const glm::vec4& color) {
+        return GlyphInstance::packColor(color);
+    }
+
+    uint32_t AuroraModel::getLiveCount() {
+        return liveModelCount.load(std::memory_order_relaxed);
+    }
+
     AuroraModel::AuroraModel(AuroraDevice& device, const AuroraModel::Builder &builder) 
         : auroraDevice{device}, isDynamicModel{builder.isDynamic} {
+        liveModelCount.fetch_add(1, std::memory_order_relaxed);
         createVertexBuffers(builder.vertices);
         
         if (builder.sharedIndexAllocation) {
@@ -20,18 +52,24 @@ namespace aurora {
     }
 
     AuroraModel::~AuroraModel() {
+        liveModelCount.fetch_sub(1, std::memory_order_relaxed);
+
+        // In-flight frames may still read these ranges, so they return to the pools once retired
+        auto& deletionQueue = auroraDevice.getDeletionQueue();
         if (vertexAllocation.isValid()) {
             if (isDynamicModel) {
-                auroraDevice.getDynamicVertexBufferPool().free(vertexAllocation);
+                deletionQueue.freeBuffer(auroraDevice.getDynamicVertexBufferPool(), vertexAllocation);
             } else {
-                auroraDevice.getVertexBufferPool().free(vertexAllocation);
+                auroraDevice.getUploadQueue().cancel(vertexAllocation);
+                deletionQueue.freeBuffer(auroraDevice.getVertexBufferPool(), vertexAllocation);
             }
         }
         if (hasIndexBuffer && indexAllocation.isValid() && ownsIndexBuffer) {
             if (isDynamicModel) {
-                 auroraDevice.getDynamicIndexBufferPool().free(indexAllocation);
+                 deletionQueue.freeBuffer(auroraDevice.getDynamicIndexBufferPool(), indexAllocation);
             } else {
-                 auroraDevice.getIndexBufferPool().free(indexAllocation);
+                 auroraDevice.getUploadQueue().cancel(indexAllocation);
+                 deletionQueue.freeBuffer(auroraDevice.getIndexBufferPool(), indexAllocation);
             }
         }
     }
@@ -58,25 +96,9 @@ namespace aurora {
                 return;
             }
 
-            auto stagingAllocation = auroraDevice.getStagingBufferPool().allocate(bufferSize);
-            if (!stagingAllocation.isValid()) {
-                log::ui()->error("Failed to allocate staging buffer from pool!");
-                return; 
-            }
-
-            if (stagingAllocation.mappedMemory) {
-                memcpy(stagingAllocation.mappedMemory, vertices.data(), (size_t)bufferSize);
+            if (!auroraDevice.getUploadQueue().uploadBuffer(vertexAllocation, vertices.data(), bufferSize)) {
+                log::ui()->error("Failed to queue vertex buffer upload!");
             }
-
-            auroraDevice.copyBuffer(
-                stagingAllocation.buffer, 
-                vertexAllocation.buffer, 
-                bufferSize, 
-                stagingAllocation.offset, 
-                vertexAllocation.offset
-            );
-
-            auroraDevice.getStagingBufferPool().free(stagingAllocation);
         }
     }
 
@@ -108,25 +130,9 @@ namespace aurora {
                 return;
             }
 
-            auto stagingAllocation = auroraDevice.getStagingBufferPool().allocate(bufferSize);
-            if (!stagingAllocation.isValid()) {
-                log::ui()->error("Failed to allocate staging buffer from pool!");
-                return; 
+            if (!auroraDevice.getUploadQueue().uploadBuffer(indexAllocation, indices.data(), bufferSize)) {
+                log::ui()->error("Failed to queue index buffer upload!");
             }
-
-            if (stagingAllocation.mappedMemory) {
-                memcpy(stagingAllocation.mappedMemory, indices.data(), (size_t)bufferSize);
-            }
-
-            auroraDevice.copyBuffer(
-                stagingAllocation.buffer, 
-                indexAllocation.buffer, 
-                bufferSize, 
-                stagingAllocation.offset, 
-                indexAllocation.offset
-            );
-
-            auroraDevice.getStagingBufferPool().free(stagingAllocation);
         }
     }
 
@@ -190,7 +196,7 @@ namespace aurora {
             memcpy(newAlloc.mappedMemory, vertexAllocation.mappedMemory, (size_t)vertexAllocation.size);
         }
 
-        auroraDevice.getDynamicVertexBufferPool().free(vertexAllocation);
+        auroraDevice.getDeletionQueue().freeBuffer(auroraDevice.getDynamicVertexBufferPool(), vertexAllocation);
         vertexAllocation = newAlloc;
     }
 
@@ -223,16 +229,14 @@ namespace aurora {
     std::vector<VkVertexInputAttributeDescription> AuroraModel::Vertex::getAttributeDescriptions() {
         std::vector<VkVertexInputAttributeDescription> attributeDescriptions{};
 
-        attributeDescriptions.push_back({0, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(Vertex, position)});
-        attributeDescriptions.push_back({1, 0, VK_FORMAT_R32G32B32A32_SFLOAT, offsetof(Vertex, color)});
-        attributeDescriptions.push_back({2, 0, VK_FORMAT_R32G32_SFLOAT, offsetof(Vertex, texCoord)});
-        
-        attributeDescriptions.push_back({3, 1, VK_FORMAT_R32G32B32A32_SFLOAT, offsetof(InstanceData, modelMatrix)});
-        attributeDescriptions.push_back({4, 1, VK_FORMAT_R32G32B32A32_SFLOAT, offsetof(InstanceData, modelMatrix) + sizeof(glm::vec4)});
-        attributeDescriptions.push_back({5, 1, VK_FORMAT_R32G32B32A32_SFLOAT, offsetof(InstanceData, modelMatrix) + 2 * sizeof(glm::vec4)});
-        attributeDescriptions.push_back({6, 1, VK_FORMAT_R32G32B32A32_SFLOAT, offsetof(InstanceData, modelMatrix) + 3 * sizeof(glm::vec4)});
+        attributeDescriptions.push_back({0, 0, VK_FORMAT_R32G32_SFLOAT, offsetof(Vertex, position)});
+        attributeDescriptions.push_back({1, 0, VK_FORMAT_R8G8B8A8_UNORM, offsetof(Vertex, color)});
+        attributeDescriptions.push_back({2, 0, VK_FORMAT_R16G16_UNORM, offsetof(Vertex, texCoord)});
 
-        attributeDescriptions.push_back({7, 1, VK_FORMAT_R32G32B32A32_SFLOAT, offsetof(InstanceData, color)});
+        attributeDescriptions.push_back({3, 1, VK_FORMAT_R32G32B32A32_SFLOAT, offsetof(InstanceData, linear)});
+        attributeDescriptions.push_back({4, 1, VK_FORMAT_R32G32_SFLOAT, offsetof(InstanceData, translation)});
+        attributeDescriptions.push_back({5, 1, VK_FORMAT_R32_SFLOAT, offsetof(InstanceData, depth)});
+        attributeDescriptions.push_back({6, 1, VK_FORMAT_R8G8B8A8_UNORM, offsetof(InstanceData, color)});
 
         return attributeDescriptions;
     }
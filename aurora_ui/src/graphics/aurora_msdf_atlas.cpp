@@ -1,8 +1,70 @@
 #include "aurora_ui/graphics/aurora_msdf_atlas.hpp"
 
+#include "aurora_engine/profiling/aurora_profiler.hpp"
+#include "aurora_engine/core/aurora_job_system.hpp"
+
 #include <stdexcept>
 #include "aurora_engine/utils/log.hpp"
+#include <cstdio>
 #include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+    constexpr char CACHE_MAGIC[8] = {'A', 'U', 'R', 'M', 'S', 'D', 'F', '\0'};
+
+    struct CacheHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t width;
+        uint32_t height;
+        uint32_t glyphCount;
+        uint32_t kerningCount;
+        uint32_t reserved;
+        uint64_t fontHash;
+        uint64_t charsetHash;
+        double pixelRange;
+        double minimumScale;
+        uint64_t pixelOffset;
+        uint64_t pixelSize;
+    };
+
+    struct CachedGlyph {
+        uint32_t codepoint;
+        float atlasBounds[4];
+        float planeBounds[4];
+        uint32_t reserved;
+        double advance;
+    };
+
+    struct CachedKerning {
+        uint64_t key;
+        double value;
+    };
+
+    constexpr uint64_t FNV_OFFSET = 14695981039346656037ull;
+    constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+    uint64_t fnv1a(const void* data, size_t size, uint64_t hash = FNV_OFFSET) {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= FNV_PRIME;
+        }
+        return hash;
+    }
+
+    // Pixels start on a 16 byte boundary after the glyph and kerning tables
+    uint64_t alignedPixelOffset(uint32_t glyphCount, uint32_t kerningCount) {
+        uint64_t offset = sizeof(CacheHeader) + glyphCount * sizeof(CachedGlyph) + kerningCount * sizeof(CachedKerning);
+        return (offset + 15) & ~uint64_t{15};
+    }
+}
 
 namespace aurora {
     AuroraMSDFAtlas::AuroraMSDFAtlas(AuroraDevice& device, const std::string& fontPath)
@@ -12,8 +74,19 @@ namespace aurora {
     AuroraMSDFAtlas::AuroraMSDFAtlas(AuroraDevice& device, const std::string& fontPath, const Config& config)
     : auroraDevice{device}, config{config}, fontHandle{nullptr}, fontGeometry{&glyphGeometry} {
         
+        AURORA_PROFILE("MSDF Atlas Load");
+
         freetypeHandle = msdfgen::initializeFreetype();
 
+        std::string cachePath = config.cachePath.empty() ? fontPath + CACHE_EXTENSION : config.cachePath;
+        CacheKey key{};
+        bool cacheable = config.useCache && computeCacheKey(fontPath, key);
+
+        if (cacheable && loadCachedAtlas(cachePath, key)) {
+            log::ui()->info("MSDF Atlas loaded from cache {} with dimensions: {}x{}", cachePath, config.width, config.height);
+            return;
+        }
+
         if (!loadFont(fontPath)) {
             throw std::runtime_error("Failed to load font: " + fontPath);
         }
@@ -22,7 +95,12 @@ namespace aurora {
             throw std::runtime_error("Failed to generate MSDF atlas");
         }
 
-        uploadAtlasToTexture();
+        std::vector<uint8_t> rgbaData = expandToRGBA();
+        uploadPixels(rgbaData.data(), rgbaData.size());
+
+        if (cacheable) {
+            writeCachedAtlas(cachePath, key, rgbaData);
+        }
 
         log::ui()->info("MSDF Atlas generated with dimensions: {}x{}", config.width, config.height);
     }
@@ -57,15 +135,17 @@ namespace aurora {
         fontGeometry.loadCharset(fontHandle, 1.0, msdf_atlas::Charset::ASCII);
 
         const double maxCornerAngle = 3.0;
-        for (msdf_atlas::GlyphGeometry &glyph : glyphs) {
-            glyph.edgeColoring(&msdfgen::edgeColoringInkTrap, maxCornerAngle, 0);
-        }
+        AuroraJobSystem::instance().parallelFor("MSDF Edge Coloring", glyphs.size(), 16, [&glyphs, maxCornerAngle](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                glyphs[i].edgeColoring(&msdfgen::edgeColoringInkTrap, maxCornerAngle, 0);
+            }
+        });
 
         msdf_atlas::TightAtlasPacker packer;
         packer.setDimensionsConstraint(msdf_atlas::DimensionsConstraint::SQUARE);
         
-        packer.setMinimumScale(96); 
-        packer.setPixelRange(4.0); 
+        packer.setMinimumScale(MINIMUM_SCALE);
+        packer.setPixelRange(PIXEL_RANGE);
         packer.setMiterLimit(1.0);
         packer.setSpacing(2.0);
 
@@ -87,7 +167,8 @@ namespace aurora {
         msdf_atlas::GeneratorAttributes attributes;
         
         generator.setAttributes(attributes);
-        generator.setThreadCount(4);
+        // The generator runs its own threads; size them like the job system, whose workers are idle here
+        generator.setThreadCount(static_cast<int>(AuroraJobSystem::instance().getThreadCount()));
 
         generator.generate(glyphs.data(), static_cast<int>(glyphs.size()));
 
@@ -137,8 +218,28 @@ namespace aurora {
         glyphCache.reserve(glyphGeometry.size());
         
         for (const auto& glyph : glyphGeometry) {
-            char character = static_cast<char>(glyph.getCodepoint());
-            glyphCache[character] = &glyph;
+            GlyphInfo glyphInfo;
+
+            double left, bottom, right, top;
+            glyph.getQuadAtlasBounds(left, bottom, right, top);
+            glyphInfo.atlasBounds = glm::vec4(
+                static_cast<float>(left / config.width),
+                static_cast<float>(bottom / config.height),
+                static_cast<float>((right - left) / config.width),
+                static_cast<float>((top - bottom) / config.height)
+            );
+
+            glyph.getQuadPlaneBounds(left, bottom, right, top);
+            glyphInfo.planeBounds = glm::vec4(
+                static_cast<float>(left),
+                static_cast<float>(bottom),
+                static_cast<float>(right - left),
+                static_cast<float>(top - bottom)
+            );
+
+            glyphInfo.advance = glyph.getAdvance();
+
+            glyphCache[static_cast<char>(glyph.getCodepoint())] = glyphInfo;
         }
         
         log::ui()->debug("Built glyph cache with {} entries", glyphCache.size());
@@ -165,6 +266,11 @@ namespace aurora {
             return;
         }
 
+        std::vector<uint8_t> rgbaData = expandToRGBA();
+        uploadPixels(rgbaData.data(), rgbaData.size());
+    }
+
+    std::vector<uint8_t> AuroraMSDFAtlas::expandToRGBA() const {
         msdfgen::BitmapConstRef<msdf_atlas::byte, 3> bitmapRef = *atlasStorage;
         const msdf_atlas::byte* bitmapData = bitmapRef.pixels;
 
@@ -176,9 +282,12 @@ namespace aurora {
             rgbaData[i * 4 + 3] = 255;
         }
 
+        return rgbaData;
+    }
+
+    void AuroraMSDFAtlas::uploadPixels(const void* rgbaData, VkDeviceSize bufferSize) {
         VkBuffer stagingBuffer;
         VkDeviceMemory stagingBufferMemory;
-        VkDeviceSize bufferSize = rgbaData.size();
 
         auroraDevice.createBuffer(
             bufferSize,
@@ -190,7 +299,7 @@ namespace aurora {
 
         void* data;
         vkMapMemory(auroraDevice.device(), stagingBufferMemory, 0, bufferSize, 0, &data);
-        memcpy(data, rgbaData.data(), bufferSize);
+        memcpy(data, rgbaData, bufferSize);
         vkUnmapMemory(auroraDevice.device(), stagingBufferMemory);
 
         VkCommandBuffer commandBuffer = auroraDevice.beginSingleTimeCommands();
@@ -217,6 +326,153 @@ namespace aurora {
         vkDestroyBuffer(auroraDevice.device(), stagingBuffer, nullptr);
         vkFreeMemory(auroraDevice.device(), stagingBufferMemory, nullptr);
     }
+
+    bool AuroraMSDFAtlas::computeCacheKey(const std::string& fontPath, CacheKey& key) {
+        std::ifstream file{fontPath, std::ios::binary};
+        if (!file.is_open()) {
+            return false;
+        }
+
+        std::vector<char> fontData{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+        key.fontHash = fnv1a(fontData.data(), fontData.size());
+
+        key.charsetHash = FNV_OFFSET;
+        for (msdf_atlas::unicode_t codepoint : msdf_atlas::Charset::ASCII) {
+            key.charsetHash = fnv1a(&codepoint, sizeof(codepoint), key.charsetHash);
+        }
+
+        key.pixelRange = PIXEL_RANGE;
+        key.minimumScale = MINIMUM_SCALE;
+        return true;
+    }
+
+    bool AuroraMSDFAtlas::loadCachedAtlas(const std::string& cachePath, const CacheKey& key) {
+        int fd = open(cachePath.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+
+        struct stat fileStat{};
+        if (fstat(fd, &fileStat) != 0 || static_cast<size_t>(fileStat.st_size) < sizeof(CacheHeader)) {
+            close(fd);
+            return false;
+        }
+
+        size_t fileSize = static_cast<size_t>(fileStat.st_size);
+        void* mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+
+        if (mapping == MAP_FAILED) {
+            return false;
+        }
+
+        const auto* bytes = static_cast<const uint8_t*>(mapping);
+        CacheHeader header;
+        memcpy(&header, bytes, sizeof(header));
+
+        bool valid = memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) == 0 &&
+                     header.version == CACHE_VERSION &&
+                     header.fontHash == key.fontHash &&
+                     header.charsetHash == key.charsetHash &&
+                     header.pixelRange == key.pixelRange &&
+                     header.minimumScale == key.minimumScale &&
+                     header.pixelSize == uint64_t{header.width} * header.height * 4 &&
+                     header.pixelOffset == alignedPixelOffset(header.glyphCount, header.kerningCount) &&
+                     header.pixelOffset + header.pixelSize == fileSize;
+
+        if (!valid) {
+            log::ui()->info("MSDF atlas cache {} is stale, regenerating", cachePath);
+            munmap(mapping, fileSize);
+            return false;
+        }
+
+        config.width = header.width;
+        config.height = header.height;
+
+        glyphCache.clear();
+        glyphCache.reserve(header.glyphCount);
+        const uint8_t* cursor = bytes + sizeof(CacheHeader);
+        for (uint32_t i = 0; i < header.glyphCount; ++i, cursor += sizeof(CachedGlyph)) {
+            CachedGlyph cached;
+            memcpy(&cached, cursor, sizeof(cached));
+
+            GlyphInfo glyphInfo;
+            glyphInfo.atlasBounds = glm::vec4(cached.atlasBounds[0], cached.atlasBounds[1], cached.atlasBounds[2], cached.atlasBounds[3]);
+            glyphInfo.planeBounds = glm::vec4(cached.planeBounds[0], cached.planeBounds[1], cached.planeBounds[2], cached.planeBounds[3]);
+            glyphInfo.advance = cached.advance;
+            glyphCache[static_cast<char>(cached.codepoint)] = glyphInfo;
+        }
+
+        kerningCache.clear();
+        kerningCache.reserve(header.kerningCount);
+        for (uint32_t i = 0; i < header.kerningCount; ++i, cursor += sizeof(CachedKerning)) {
+            CachedKerning cached;
+            memcpy(&cached, cursor, sizeof(cached));
+            kerningCache[cached.key] = cached.value;
+        }
+
+        // The mapped pixels are already RGBA and go straight into the staging buffer
+        createAtlasTexture();
+        uploadPixels(bytes + header.pixelOffset, header.pixelSize);
+
+        munmap(mapping, fileSize);
+        return true;
+    }
+
+    void AuroraMSDFAtlas::writeCachedAtlas(const std::string& cachePath, const CacheKey& key, const std::vector<uint8_t>& rgbaData) const {
+        CacheHeader header{};
+        memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+        header.version = CACHE_VERSION;
+        header.width = config.width;
+        header.height = config.height;
+        header.glyphCount = static_cast<uint32_t>(glyphCache.size());
+        header.kerningCount = static_cast<uint32_t>(kerningCache.size());
+        header.fontHash = key.fontHash;
+        header.charsetHash = key.charsetHash;
+        header.pixelRange = key.pixelRange;
+        header.minimumScale = key.minimumScale;
+        header.pixelOffset = alignedPixelOffset(header.glyphCount, header.kerningCount);
+        header.pixelSize = rgbaData.size();
+
+        // Written to a temporary file and renamed so a crash never leaves a truncated cache behind
+        std::string tempPath = cachePath + ".tmp";
+        std::ofstream file{tempPath, std::ios::binary | std::ios::trunc};
+        if (!file.is_open()) {
+            log::ui()->warn("Failed to open MSDF atlas cache {} for writing", tempPath);
+            return;
+        }
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        for (const auto& [character, glyphInfo] : glyphCache) {
+            CachedGlyph cached{};
+            cached.codepoint = static_cast<unsigned char>(character);
+            for (int i = 0; i < 4; ++i) {
+                cached.atlasBounds[i] = glyphInfo.atlasBounds[i];
+                cached.planeBounds[i] = glyphInfo.planeBounds[i];
+            }
+            cached.advance = glyphInfo.advance;
+            file.write(reinterpret_cast<const char*>(&cached), sizeof(cached));
+        }
+
+        for (const auto& [kerningKey, value] : kerningCache) {
+            CachedKerning cached{kerningKey, value};
+            file.write(reinterpret_cast<const char*>(&cached), sizeof(cached));
+        }
+
+        static const char padding[16] = {};
+        file.write(padding, static_cast<std::streamsize>(header.pixelOffset - static_cast<uint64_t>(file.tellp())));
+        file.write(reinterpret_cast<const char*>(rgbaData.data()), static_cast<std::streamsize>(rgbaData.size()));
+        file.close();
+
+        if (!file || std::rename(tempPath.c_str(), cachePath.c_str()) != 0) {
+            log::ui()->warn("Failed to write MSDF atlas cache {}", cachePath);
+            std::remove(tempPath.c_str());
+            return;
+        }
+
+        log::ui()->info("Wrote MSDF atlas cache {} ({} KB)", cachePath, (header.pixelOffset + header.pixelSize) / 1024);
+    }
     
     void AuroraMSDFAtlas::saveAtlasAsPNG(const std::string& outputPath) const {
         if (!atlasTexture) {
@@ -224,6 +480,11 @@ namespace aurora {
             return;
         }
 
+        if (!atlasStorage) {
+            log::ui()->error("Atlas was loaded from cache, no generated bitmap to save as PNG");
+            return;
+        }
+
         msdfgen::BitmapConstRef<msdf_atlas::byte, 3> bitmapRef = *atlasStorage;
 
         bool success = msdf_atlas::saveImage(
@@ -245,28 +506,7 @@ namespace aurora {
             return false;
         }
         
-        const auto& glyph = *it->second;
-        
-        double left, bottom, right, top;
-        glyph.getQuadAtlasBounds(left, bottom, right, top);
-        
-        glyphInfo.atlasBounds = glm::vec4(
-            static_cast<float>(left / config.width),
-            static_cast<float>(bottom / config.height),
-            static_cast<float>((right - left) / config.width),
-            static_cast<float>((top - bottom) / config.height)
-        );
-        
-        glyph.getQuadPlaneBounds(left, bottom, right, top);
-        glyphInfo.planeBounds = glm::vec4(
-            static_cast<float>(left),
-            static_cast<float>(bottom),
-            static_cast<float>(right - left),
-            static_cast<float>(top - bottom)
-        );
-        
-        glyphInfo.advance = glyph.getAdvance();
-        
+        glyphInfo = it->second;
         return true;
     }
     
@@ -281,37 +521,4 @@ namespace aurora {
         
         return 0.0;
     }
-
-    const BufferAllocation& AuroraMSDFAtlas::getSharedIndexAllocation() {
-        if (!sharedIndexAllocation.isValid()) {
-            ensureSharedIndexBuffer();
-        }
-        return sharedIndexAllocation;
-    }
-
-    void AuroraMSDFAtlas::ensureSharedIndexBuffer() {
-        if (sharedIndexAllocation.isValid()) return;
-
-        std::vector<uint32_t> indices;
-        indices.reserve(MAX_TEXT_CHARS * 6);
-        for (size_t i=0; i<MAX_TEXT_CHARS; ++i) {
-            uint32_t base = static_cast<uint32_t>(i * 4);
-            indices.push_back(base);
-            indices.push_back(base+1);
-            indices.push_back(base+2);
-            indices.push_back(base+2);
-            indices.push_back(base+3);
-            indices.push_back(base);
-        }
-
-        VkDeviceSize size = indices.size() * sizeof(uint32_t);
-        sharedIndexAllocation = auroraDevice.getIndexBufferPool().allocate(size);
-
-        auto staging = auroraDevice.getStagingBufferPool().allocate(size);
-        if (staging.mappedMemory) {
-            memcpy(staging.mappedMemory, indices.data(), (size_t)size);
-        }
-        auroraDevice.copyBuffer(staging.buffer, sharedIndexAllocation.buffer, size, staging.offset, sharedIndexAllocation.offset);
-        auroraDevice.getStagingBufferPool().free(staging);
-    }
 }
\ No newline at end of file
@@ -1,8 +1,8 @@
 #include "aurora_ui/graphics/aurora_pipeline.hpp"
 #include "aurora_ui/graphics/aurora_model.hpp"
+#include "aurora_engine/core/aurora_deletion_queue.hpp"
+#include "aurora_engine/core/aurora_pipeline_cache.hpp"
 
-#include <iostream>
-#include <fstream>
 #include <cassert>
 #include <spdlog/spdlog.h>
 
@@ -12,38 +12,17 @@ namespace aurora {
     }
 
     AuroraPipeline::~AuroraPipeline() {
-        vkDestroyShaderModule(auroraDevice.device(), vertShaderModule, nullptr);
-        vkDestroyShaderModule(auroraDevice.device(), fragShaderModule, nullptr);
-        vkDestroyPipeline(auroraDevice.device(), graphicsPipeline, nullptr);
-    }
-
-    std::vector<char> AuroraPipeline::readFile(const std::string& filePath) {
-        std::ifstream file{filePath, std::ios::ate | std::ios::binary};
-
-        if (!file.is_open()) {
-            throw std::runtime_error("Failed to open file: " + filePath);
-        }
-
-        size_t fileSize = static_cast<size_t>(file.tellg());
-        std::vector<char> buffer(fileSize);
-
-        file.seekg(0);
-        file.read(buffer.data(), fileSize);
-        
-        file.close();
-
-        return buffer;
+        // Shader modules belong to the device's pipeline cache and are shared with other pipelines
+        auroraDevice.getDeletionQueue().destroyPipeline(graphicsPipeline);
     }
 
     void AuroraPipeline::createGraphicsPipeline(const std::string& vertFilePath, const std::string& fragFilePath, const PipelineConfigInfo& configInfo) {
         assert(configInfo.pipelineLayout != VK_NULL_HANDLE && "Cannot create graphics pipeline: no pipeline layout provided");
         assert(configInfo.renderPass != VK_NULL_HANDLE && "Cannot create graphics pipeline: no render pass provided");
         
-        auto vertCode = readFile(vertFilePath);
-        auto fragCode = readFile(fragFilePath);
-
-        createShaderModule(vertCode, &vertShaderModule);
-        createShaderModule(fragCode, &fragShaderModule);
+        AuroraPipelineCache& pipelineCache = auroraDevice.getPipelineCache();
+        VkShaderModule vertShaderModule = pipelineCache.getShaderModule(vertFilePath);
+        VkShaderModule fragShaderModule = pipelineCache.getShaderModule(fragFilePath);
 
         VkPipelineShaderStageCreateInfo shaderStages[2];
         shaderStages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
@@ -62,8 +41,8 @@ namespace aurora {
         shaderStages[1].pNext = nullptr;
         shaderStages[1].pSpecializationInfo = nullptr;
 
-        auto bindingDescriptions = AuroraModel::Vertex::getBindingDescriptions();
-        auto attributeDescriptions = AuroraModel::Vertex::getAttributeDescriptions();
+        auto& bindingDescriptions = configInfo.bindingDescriptions;
+        auto& attributeDescriptions = configInfo.attributeDescriptions;
 
         VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
         vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
@@ -92,22 +71,11 @@ namespace aurora {
         pipelineInfo.basePipelineIndex = -1;
         pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
 
-        if (vkCreateGraphicsPipelines(auroraDevice.device(), VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &graphicsPipeline) != VK_SUCCESS) {
+        if (vkCreateGraphicsPipelines(auroraDevice.device(), pipelineCache.getCache(), 1, &pipelineInfo, nullptr, &graphicsPipeline) != VK_SUCCESS) {
             throw std::runtime_error("Failed to create graphics pipeline");
         }
     }
 
-    void AuroraPipeline::createShaderModule(const std::vector<char>& code, VkShaderModule* shaderModule) {
-        VkShaderModuleCreateInfo createInfo{};
-        createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-        createInfo.codeSize = code.size();
-        createInfo.pCode = reinterpret_cast<const uint32_t*>(code.data());
-
-        if (vkCreateShaderModule(auroraDevice.device(), &createInfo, nullptr, shaderModule) != VK_SUCCESS) {
-            throw std::runtime_error("Failed to create shader module");
-        }
-    }
-
     void AuroraPipeline::bind(VkCommandBuffer commandBuffer) {
         vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline);
     }
@@ -178,5 +146,8 @@ namespace aurora {
         configInfo.dynamicStateInfo.pDynamicStates = configInfo.dynamicStateEnables.data();
         configInfo.dynamicStateInfo.dynamicStateCount = static_cast<uint32_t>(configInfo.dynamicStateEnables.size());
         configInfo.dynamicStateInfo.flags = 0;
+
+        configInfo.bindingDescriptions = AuroraModel::Vertex::getBindingDescriptions();
+        configInfo.attributeDescriptions = AuroraModel::Vertex::getAttributeDescriptions();
     }
 }
\ No newline at end of file
@@ -1,12 +1,15 @@
 #include "aurora_ui/graphics/aurora_render_system.hpp"
 #include "aurora_ui/components/aurora_component_interface.hpp"
 #include "aurora_engine/profiling/aurora_profiler.hpp"
+#include "aurora_engine/core/aurora_deletion_queue.hpp"
+#include "aurora_engine/core/aurora_swap_chain.hpp"
 
 #define GLM_FORCE_RADIANS
 #define GLM_FORCE_DEPTH_ZERO_TO_ONE
 #include <glm/glm.hpp>
 #include <glm/gtc/constants.hpp>
 
+#include <algorithm>
 #include <stdexcept>
 #include <array>
 #include "aurora_engine/utils/log.hpp"
@@ -17,17 +20,39 @@ namespace aurora {
         : auroraDevice{device}, 
           globalDescriptorPool{createInfo.descriptorPool}, 
           msdfAtlas{createInfo.msdfAtlas},
-          vertexShaderPath{createInfo.vertFilePath}, 
-          fragmentShaderPath{createInfo.fragFilePath}, 
-          topology{createInfo.topology},
-          needsTextureBinding{createInfo.needsTextureBinding},
-          transparent{createInfo.isTransparent} {
+          pipeline{createInfo.pipeline},
+          vertexShaderPath{createInfo.pipeline.getVertexShaderPath()},
+          fragmentShaderPath{createInfo.pipeline.getFragmentShaderPath()},
+          needsTextureBinding{createInfo.pipeline.needsTextureBinding()},
+          glyphInstanced{createInfo.pipeline.getInstancing() == InstancingMode::GLYPH},
+          shapeInstanced{createInfo.pipeline.getInstancing() == InstancingMode::SHAPE} {
+        // "shaders/text.frag.spv" is reported as "GPU: text system"
+        size_t nameStart = fragmentShaderPath.find_last_of("/\\");
+        nameStart = nameStart == std::string::npos ? 0 : nameStart + 1;
+        gpuZoneName = "GPU: " + fragmentShaderPath.substr(nameStart, fragmentShaderPath.find('.', nameStart) - nameStart) + " system";
+
         createPipelineLayout();
-        createPipeline(createInfo.renderPass, createInfo.vertFilePath, createInfo.fragFilePath, createInfo.topology);
+        createPipeline(createInfo.renderPass);
+
+        VkDeviceSize instanceStride = sizeof(AuroraModel::InstanceData);
+        if (glyphInstanced) {
+            instanceStride = sizeof(GlyphInstance);
+        } else if (shapeInstanced) {
+            instanceStride = sizeof(ShapeInstance);
+        }
+        instanceStore = std::make_unique<AuroraInstanceStore>(auroraDevice, instanceStride, AuroraSwapChain::MAX_FRAMES_IN_FLIGHT);
     }
 
     AuroraRenderSystem::~AuroraRenderSystem() {
-        vkDestroyPipelineLayout(auroraDevice.device(), pipelineLayout, nullptr);
+        for (const auto& component : components) {
+            component->renderSystem = nullptr;
+        }
+
+        if (sharedDescriptorSet != VK_NULL_HANDLE) {
+            std::vector<VkDescriptorSet> descriptorSets{sharedDescriptorSet};
+            globalDescriptorPool->freeDescriptors(descriptorSets);
+        }
+        auroraDevice.getDeletionQueue().destroyPipelineLayout(pipelineLayout);
     }
 
     void AuroraRenderSystem::createPipelineLayout() {
@@ -58,19 +83,52 @@ namespace aurora {
         }
     }
 
-    void AuroraRenderSystem::createPipeline(VkRenderPass renderPass, const std::string& vertFilePath, const std::string& fragFilePath, VkPrimitiveTopology topology) {
+    void AuroraRenderSystem::createPipeline(VkRenderPass renderPass) {
         assert(pipelineLayout != nullptr && "Pipeline layout must be created before creating the pipeline");
 
         PipelineConfigInfo pipelineConfig{};
-        AuroraPipeline::defaultPipelineConfigInfo(pipelineConfig, topology, auroraDevice.msaaSamples);
-        
-        if (transparent) {
-             pipelineConfig.depthStencilInfo.depthWriteEnable = VK_FALSE;
+        AuroraPipeline::defaultPipelineConfigInfo(pipelineConfig, pipeline.getTopology(), auroraDevice.msaaSamples);
+
+        // The default config alpha blends and reads and writes depth
+        switch (pipeline.getBlend()) {
+            case BlendMode::NONE:
+                pipelineConfig.colorBlendAttachment.blendEnable = VK_FALSE;
+                break;
+            case BlendMode::ADDITIVE:
+                pipelineConfig.colorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE;
+                break;
+            case BlendMode::ALPHA:
+                break;
+        }
+
+        switch (pipeline.getDepth()) {
+            case DepthMode::READ_ONLY:
+                pipelineConfig.depthStencilInfo.depthWriteEnable = VK_FALSE;
+                break;
+            case DepthMode::DISABLED:
+                pipelineConfig.depthStencilInfo.depthTestEnable = VK_FALSE;
+                pipelineConfig.depthStencilInfo.depthWriteEnable = VK_FALSE;
+                break;
+            case DepthMode::READ_WRITE:
+                break;
+        }
+
+        if (glyphInstanced) {
+            pipelineConfig.bindingDescriptions = GlyphInstance::getBindingDescriptions();
+            pipelineConfig.attributeDescriptions = GlyphInstance::getAttributeDescriptions();
+        } else if (shapeInstanced) {
+            pipelineConfig.bindingDescriptions = ShapeInstance::getBindingDescriptions();
+            pipelineConfig.attributeDescriptions = ShapeInstance::getAttributeDescriptions();
         }
 
         pipelineConfig.renderPass = renderPass;
         pipelineConfig.pipelineLayout = pipelineLayout;
-        auroraPipeline = std::make_unique<AuroraPipeline>(auroraDevice, vertFilePath, fragFilePath, pipelineConfig);
+        auroraPipeline = std::make_unique<AuroraPipeline>(auroraDevice, vertexShaderPath, fragmentShaderPath, pipelineConfig);
+    }
+
+    void AuroraRenderSystem::rebuildPipeline(VkRenderPass renderPass) {
+        // The old pipeline is released through the deletion queue once in-flight frames retire
+        createPipeline(renderPass);
     }
 
     void AuroraRenderSystem::createComponentDescriptorSets(size_t /*componentIndex*/, AuroraMSDFAtlas* msdfAtlas) {
@@ -91,29 +149,191 @@ namespace aurora {
 
     void AuroraRenderSystem::addComponent(std::shared_ptr<AuroraComponentInterface> component) {
         size_t componentIndex = components.size();
+        component->renderSystem = this;
+        component->systemSlot = static_cast<uint32_t>(componentIndex);
+        component->instanceRange = AuroraInstanceStore::INVALID_RANGE;
         components.push_back(component);
         createComponentDescriptorSets(componentIndex, msdfAtlas);
+        layoutDirty = true;
+    }
+
+    void AuroraRenderSystem::removeComponent(AuroraComponentInterface& component) {
+        uint32_t slot = component.systemSlot;
+        assert(component.renderSystem == this && slot < components.size() && components[slot].get() == &component && "Component is not in this render system");
+
+        component.renderSystem = nullptr;
+        component.systemSlot = UINT32_MAX;
+        component.instanceRange = AuroraInstanceStore::INVALID_RANGE;
+
+        // Draw order comes from the layout, not from the slot order, so the last slot can move in.
+        // This may drop the last reference to the component.
+        if (slot + 1 != components.size()) {
+            std::swap(components[slot], components.back());
+            components[slot]->systemSlot = slot;
+        }
+        components.pop_back();
+
+        // The layout and the visible list still point at the removed component; the manager
+        // reports the visible components again before the next recording
+        visibleComponents.clear();
+        changedRanges.clear();
+        layoutDirty = true;
+    }
+
+    void AuroraRenderSystem::endVisibilityUpdate() {
+        // Slot order keeps the layout close to insertion order and makes the lists comparable
+        std::sort(nextVisibleComponents.begin(), nextVisibleComponents.end(), [](const AuroraComponentInterface* a, const AuroraComponentInterface* b) {
+            return a->systemSlot < b->systemSlot;
+        });
+
+        if (nextVisibleComponents != visibleComponents) {
+            visibleComponents.swap(nextVisibleComponents);
+            layoutDirty = true;
+        }
+    }
+
+    void AuroraRenderSystem::markInstancesChanged(const AuroraComponentInterface& component) {
+        // A pending layout rewrites every range anyway
+        uint32_t range = component.instanceRange;
+        if (layoutDirty || range >= layout.size() || layout[range].component != &component) {
+            return;
+        }
+
+        if (!rangeChanged[range]) {
+            rangeChanged[range] = 1;
+            changedRanges.push_back(range);
+        }
+    }
+
+    const void* AuroraRenderSystem::gatherInstances(const AuroraComponentInterface& component, uint32_t& count) {
+        if (glyphInstanced) {
+            glyphInstances.clear();
+            component.appendGlyphInstances(glyphInstances);
+            count = static_cast<uint32_t>(glyphInstances.size());
+            return glyphInstances.data();
+        }
+
+        if (shapeInstanced) {
+            shapeInstances.clear();
+            component.appendShapeInstances(shapeInstances);
+            count = static_cast<uint32_t>(shapeInstances.size());
+            return shapeInstances.data();
+        }
+
+        modelInstances.clear();
+        if (component.model) {
+            modelInstances.push_back(AuroraModel::InstanceData::fromWorldTransform(component.getWorldTransform(), component.getColor()));
+        }
+        count = static_cast<uint32_t>(modelInstances.size());
+        return modelInstances.data();
+    }
+
+    void AuroraRenderSystem::rebuildInstanceLayout() {
+        std::vector<AuroraComponentInterface*> order = visibleComponents;
+
+        if (shapeInstanced || glyphInstanced) {
+            // Edges, shadows and glyphs blend, so draw back to front within the call
+            std::stable_sort(order.begin(), order.end(), [](const AuroraComponentInterface* a, const AuroraComponentInterface* b) {
+                return a->getWorldTransform()[3][2] > b->getWorldTransform()[3][2];
+            });
+        } else {
+            // Keep each model's instances contiguous so a batch is a single instanced draw
+            std::unordered_map<AuroraModel*, size_t> firstSeen;
+            for (auto* component : order) {
+                firstSeen.emplace(component->model.get(), firstSeen.size());
+            }
+            std::stable_sort(order.begin(), order.end(), [&firstSeen](const AuroraComponentInterface* a, const AuroraComponentInterface* b) {
+                return firstSeen.at(a->model.get()) < firstSeen.at(b->model.get());
+            });
+        }
+
+        instanceStore->clear();
+        layout.clear();
+        modelBatches.clear();
+
+        for (auto* component : order) {
+            uint32_t count = 0;
+            const void* instances = gatherInstances(*component, count);
+
+            uint32_t range = instanceStore->addRange(instances, count);
+            if (component->isHidden()) {
+                instanceStore->clearRange(range);
+            }
+            component->instanceRange = range;
+            layout.push_back({component, component->model.get(), component->getWorldTransform()[3][2]});
+
+            AuroraModel* model = component->model.get();
+            if (!glyphInstanced && !shapeInstanced && model && count > 0) {
+                if (modelBatches.empty() || modelBatches.back().model != model) {
+                    modelBatches.push_back({model, instanceStore->getFirstInstance(range), 0});
+                }
+                modelBatches.back().instanceCount += count;
+            }
+        }
+
+        changedRanges.clear();
+        rangeChanged.assign(layout.size(), 0);
+        layoutDirty = false;
+
+        AuroraProfiler::instance().incrementCounter("Instance Layouts");
     }
 
-    void AuroraRenderSystem::removeComponent(std::shared_ptr<AuroraComponentInterface> component) {
-        auto it = std::find(components.begin(), components.end(), component);
-        if (it != components.end()) {
-            components.erase(it);
+    bool AuroraRenderSystem::rewriteInstances(uint32_t range) {
+        const LayoutEntry& entry = layout[range];
+        const AuroraComponentInterface& component = *entry.component;
+
+        if (component.model.get() != entry.model) {
+            return false;
+        }
+        if ((shapeInstanced || glyphInstanced) && component.getWorldTransform()[3][2] != entry.depth) {
+            return false;
+        }
+
+        uint32_t count = 0;
+        const void* instances = gatherInstances(component, count);
+
+        // Hidden components keep their slots so showing them again is just another rewrite
+        if (component.isHidden()) {
+            if (count != instanceStore->getInstanceCount(range)) {
+                return false;
+            }
+            instanceStore->clearRange(range);
+            return true;
+        }
+
+        return instanceStore->writeRange(range, instances, count);
+    }
+
+    void AuroraRenderSystem::updateInstances() {
+        if (!layoutDirty) {
+            for (uint32_t range : changedRanges) {
+                rangeChanged[range] = 0;
+                if (!rewriteInstances(range)) {
+                    layoutDirty = true;
+                    break;
+                }
+            }
+            changedRanges.clear();
+        }
+
+        if (layoutDirty) {
+            rebuildInstanceLayout();
         }
     }
 
     void AuroraRenderSystem::renderComponents(VkCommandBuffer commandBuffer, const AuroraCamera& camera, int frameIndex) {
+        updateInstances();
+        if (instanceStore->getInstanceCount() == 0) {
+            return;
+        }
+        instanceStore->upload(static_cast<uint32_t>(frameIndex));
+
         auroraPipeline->bind(commandBuffer);
 
         if (needsTextureBinding && sharedDescriptorSet != VK_NULL_HANDLE) {
             vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, 1, &sharedDescriptorSet, 0, nullptr);
         }
 
-        for (auto& allocation : frameInstanceAllocations[frameIndex]) {
-            auroraDevice.getDynamicVertexBufferPool().free(allocation);
-        }
-        frameInstanceAllocations[frameIndex].clear();
-
         PushConstantData pushData{};
         pushData.projectionViewMatrix = camera.getProjection();
         
@@ -126,56 +346,42 @@ namespace aurora {
             &pushData
         );
 
-        for (auto& [model, instances] : batches) {
-            instances.clear();
+        if (glyphInstanced) {
+            renderInstancedQuads(commandBuffer, frameIndex, "Glyph Instances");
+        } else if (shapeInstanced) {
+            renderInstancedQuads(commandBuffer, frameIndex, "Shape Instances");
+        } else {
+            renderModels(commandBuffer, frameIndex);
         }
-        
-        for (const auto& component : components) {
-            if (component->isHidden() || !component->model) {
-                continue;
-            }
-            
-            AuroraModel::InstanceData data{};
-            data.modelMatrix = component->getWorldTransform();
-            data.color = component->color;
-            
-            batches[component->model.get()].push_back(data);
-        }
-
-        for (auto& [model, instances] : batches) {
-             if (instances.empty()) continue;
-             
-             VkDeviceSize bufferSize = sizeof(AuroraModel::InstanceData) * instances.size();
-             auto allocation = auroraDevice.getDynamicVertexBufferPool().allocate(bufferSize);
-             
-             if (!allocation.isValid()) {
-                 log::ui()->error("Failed to allocate instance buffer from pool!");
-                 continue;
-             }
-             
-             if (allocation.mappedMemory) {
-                memcpy(allocation.mappedMemory, instances.data(), (size_t)bufferSize);
-             }
-             
-             frameInstanceAllocations[frameIndex].push_back(allocation);
-
-             model->bind(commandBuffer);
-             
-             VkBuffer buffers[] = {allocation.buffer};
-             VkDeviceSize offsets[] = {allocation.offset};
+    }
+
+    void AuroraRenderSystem::renderModels(VkCommandBuffer commandBuffer, int frameIndex) {
+        VkBuffer buffers[] = {instanceStore->getBuffer(frameIndex)};
+
+        for (const auto& batch : modelBatches) {
+             batch.model->bind(commandBuffer);
+
+             VkDeviceSize offsets[] = {instanceStore->getOffset(frameIndex, batch.firstInstance)};
              vkCmdBindVertexBuffers(commandBuffer, 1, 1, buffers, offsets);
-             
-             model->draw(commandBuffer, static_cast<uint32_t>(instances.size()));
-             
+
+             batch.model->draw(commandBuffer, batch.instanceCount);
+
              AuroraProfiler::instance().incrementCounter("Draw Calls");
         }
     }
 
-    bool AuroraRenderSystem::isCompatibleWith(const AuroraComponentInterface& component) const {
-        return vertexShaderPath == component.getVertexShaderPath() &&
-               fragmentShaderPath == component.getFragmentShaderPath() &&
-               topology == component.getTopology() &&
-               needsTextureBinding == component.needsTextureBinding() &&
-               transparent == component.isTransparent();
+    void AuroraRenderSystem::renderInstancedQuads(VkCommandBuffer commandBuffer, int frameIndex, const char* instanceCounter) {
+        uint32_t instanceCount = instanceStore->getInstanceCount();
+
+        // Ranges were laid out back to front, see rebuildInstanceLayout()
+        VkBuffer buffers[] = {instanceStore->getBuffer(frameIndex)};
+        VkDeviceSize offsets[] = {instanceStore->getOffset(frameIndex)};
+        vkCmdBindVertexBuffers(commandBuffer, 0, 1, buffers, offsets);
+
+        vkCmdDraw(commandBuffer, 6, instanceCount, 0, 0);
+
+        auto& profiler = AuroraProfiler::instance();
+        profiler.incrementCounter("Draw Calls");
+        profiler.incrementCounter(instanceCounter, instanceCount);
     }
 }
\ No newline at end of file
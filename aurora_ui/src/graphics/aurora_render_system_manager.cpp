@@ -1,15 +1,20 @@
 #include "aurora_ui/graphics/aurora_render_system_manager.hpp"
 #include "aurora_ui/components/aurora_component_interface.hpp"
 #include "aurora_ui/utils/aurora_theme_settings.hpp"
+#include "aurora_engine/core/aurora_job_system.hpp"
+#include "aurora_engine/profiling/aurora_profiler.hpp"
 #include "aurora_engine/utils/log.hpp"
 
+#include <algorithm>
+#include <cassert>
 #include <memory>
 
 namespace aurora {
     AuroraRenderSystemManager::AuroraRenderSystemManager(AuroraDevice& device, AuroraRenderer& renderer) 
-    : auroraDevice{device}, auroraRenderer{renderer} {
+    : auroraDevice{device}, auroraRenderer{renderer}, geometryCache{device}, pipelineSamples{device.msaaSamples} {
         globalDescriptorPool = AuroraDescriptorPool::Builder(auroraDevice)
             .setMaxSets(100)
+            .setPoolFlags(VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT)
             .addPoolSize(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 100)
             .build();
 
@@ -23,28 +28,128 @@ namespace aurora {
         if (compatibleSystem) {
             compatibleSystem->addComponent(component);
         } else {
-            auto newRenderSystem = createRenderSystem(*component);
+            auto newRenderSystem = createRenderSystem(component->getPipeline());
             newRenderSystem->addComponent(component);
+            renderSystemsByKey.emplace(newRenderSystem->getPipelineKey(), newRenderSystem.get());
             renderSystems.push_back(std::move(newRenderSystem));
         }
     }
 
+    void AuroraRenderSystemManager::addComponentToQueue(std::shared_ptr<AuroraComponentInterface> component) {
+        if (component->managerSlot != UINT32_MAX) return;
+
+        component->managerSlot = static_cast<uint32_t>(components.size());
+        componentQueue.push_back(component);
+        components.push_back(component);
+        markDirty();
+    }
+
     void AuroraRenderSystemManager::removeComponent(std::shared_ptr<AuroraComponentInterface> component) {
-        auto it = std::find(components.begin(), components.end(), component);
-        if (it != components.end()) {
-            components.erase(it);
+        // The parameter keeps the subtree alive while it is unlinked
+        if (auto parent = component->parent.lock()) {
+            auto& siblings = parent->children;
+            auto it = std::find(siblings.begin(), siblings.end(), component);
+            if (it != siblings.end()) {
+                siblings.erase(it);
+            }
+        }
+        component->parent.reset();
+        sceneStore.setParent(component->node, AuroraSceneStore::INVALID_NODE);
+
+        detachSubtree(*component);
+
+        if (removedComponentSlots * 2 > components.size()) {
+            compactComponents();
+        }
+        cullDirty = true;
+        markDirty();
+    }
+
+    void AuroraRenderSystemManager::detachSubtree(AuroraComponentInterface& component) {
+        component.rendering = false;
+
+        if (component.renderSystem) {
+            component.renderSystem->removeComponent(component);
+        }
+        if (component.managerSlot != UINT32_MAX) {
+            components[component.managerSlot] = nullptr;
+            component.managerSlot = UINT32_MAX;
+            ++removedComponentSlots;
+        }
+
+        // Each child is kept alive by its parent's list
+        for (const auto& child : component.children) {
+            detachSubtree(*child);
+        }
+    }
+
+    void AuroraRenderSystemManager::compactComponents() {
+        size_t live = 0;
+        for (auto& component : components) {
+            if (!component) continue;
+            component->managerSlot = static_cast<uint32_t>(live);
+            components[live++] = std::move(component);
+        }
+        components.resize(live);
+        removedComponentSlots = 0;
+    }
+
+    void AuroraRenderSystemManager::registerPreRender(AuroraComponentInterface* component) {
+        preRenderComponents.push_back(component);
+    }
+
+    void AuroraRenderSystemManager::unregisterPreRender(AuroraComponentInterface* component) {
+        auto it = std::find(preRenderComponents.begin(), preRenderComponents.end(), component);
+        if (it != preRenderComponents.end()) {
+            preRenderComponents.erase(it);
+        }
+    }
+
+    void AuroraRenderSystemManager::warmUpPipelines(const std::vector<PipelineDescriptor>& pipelines) {
+        AURORA_PROFILE("Pipeline Warm-Up");
+
+        std::vector<const PipelineDescriptor*> missing;
+        for (const auto& pipeline : pipelines) {
+            bool listed = std::any_of(missing.begin(), missing.end(), [&pipeline](const PipelineDescriptor* other) {
+                return other->getKey() == pipeline.getKey();
+            });
+            if (!listed && renderSystemsByKey.find(pipeline.getKey()) == renderSystemsByKey.end()) {
+                missing.push_back(&pipeline);
+            }
         }
-        auto itQueue = std::find(componentQueue.begin(), componentQueue.end(), component);
-        if (itQueue != componentQueue.end()) {
-            componentQueue.erase(itQueue);
+        if (missing.empty()) return;
+
+        // Constructing a render system only creates device objects, which any thread may do; the
+        // pipelines share the device's pipeline cache and shader modules
+        std::vector<std::unique_ptr<AuroraRenderSystem>> created(missing.size());
+        AuroraJobSystem::instance().parallelFor("Create Render Systems", missing.size(), 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                created[i] = createRenderSystem(*missing[i]);
+            }
+        });
+
+        // Registered in list order, which is their draw order among systems of the same transparency
+        for (auto& renderSystem : created) {
+            renderSystemsByKey.emplace(renderSystem->getPipelineKey(), renderSystem.get());
+            renderSystems.push_back(std::move(renderSystem));
         }
-        for (auto& sys : renderSystems) {
-            sys->removeComponent(component);
+        log::ui()->info("Warmed up {} pipelines on {} threads", missing.size(), AuroraJobSystem::instance().getThreadCount());
+    }
+
+    void AuroraRenderSystemManager::rebuildPipelines() {
+        log::ui()->info("Rebuilding {} render system pipelines for {}x MSAA", renderSystems.size(), static_cast<int>(auroraDevice.msaaSamples));
+
+        VkRenderPass renderPass = auroraRenderer.getSwapChainRenderPass();
+        for (auto& renderSystem : renderSystems) {
+            renderSystem->rebuildPipeline(renderPass);
         }
+        pipelineSamples = auroraDevice.msaaSamples;
     }
 
     void AuroraRenderSystemManager::recalculateAllDepths(std::vector<std::shared_ptr<AuroraComponentInterface>>& components, float& depth, float depthIncrement) {
         for (const auto& component : components) {
+            if (!component) continue;
+
             component->setDepth(depth);
             depth -= depthIncrement;
 
@@ -56,38 +161,150 @@ namespace aurora {
     }
 
     void AuroraRenderSystemManager::renderAllComponents(VkCommandBuffer commandBuffer, const AuroraCamera& camera) {
+        if (pipelineSamples != auroraDevice.msaaSamples) {
+            rebuildPipelines();
+        }
+
+        for (auto* component : preRenderComponents) {
+            component->prepareRender();
+        }
+
         if (!componentQueue.empty()) {
             log::ui()->debug("Processing component queue with {} components", componentQueue.size());
             for (const auto& component : componentQueue) {
-                addComponentToRenderSystems(component);
+                // Skip components removed while queued, or removed and queued again
+                if (component->managerSlot != UINT32_MAX && !component->renderSystem) {
+                    addComponentToRenderSystems(component);
+                }
             }
             componentQueue.clear();
+            cullDirty = true;
 
             float depth = MAX_DEPTH;
             recalculateAllDepths(components, depth, DEPTH_INCREMENT);
             log::ui()->debug("Created {} render systems with {} total components", renderSystems.size(), getTotalComponentCount());
         }
 
-        std::vector<AuroraRenderSystem*> opaqueSystems;
-        std::vector<AuroraRenderSystem*> transparentSystems;
+        // Every transform is current before render systems read them from the recording jobs
+        sceneStore.updateTransforms();
+
+        cullRenderSystems(camera);
+
+        auto& profiler = AuroraProfiler::instance();
+        // Scene nodes outlive detached components a caller still holds, so they are counted from the manager's slots
+        profiler.setCounter("Live Components", components.size() - removedComponentSlots);
+        profiler.setCounter("Live Models", AuroraModel::getLiveCount());
+        profiler.setCounter("Visible Components", visibleComponents.size());
+
+        orderedSystems.clear();
+        for (const auto& renderSystem : renderSystems) {
+            if (renderSystem->getComponentCount() > 0 && !renderSystem->isTransparent()) {
+                orderedSystems.push_back(renderSystem.get());
+            }
+        }
+        for (const auto& renderSystem : renderSystems) {
+            if (renderSystem->getComponentCount() > 0 && renderSystem->isTransparent()) {
+                orderedSystems.push_back(renderSystem.get());
+            }
+        }
+
+        if (orderedSystems.empty()) {
+            return;
+        }
+
+        buildRecordingChunks();
+        recordingCamera = &camera;
+        recordingFrameIndex = auroraRenderer.getFrameIndex();
+
+        // The main thread records the first chunk itself and helps with the rest while waiting
+        AuroraJobSystem::instance().parallelFor("Record Render Systems", recordingChunks.size(), 1, [this](size_t begin, size_t end) {
+            for (size_t chunk = begin; chunk < end; ++chunk) {
+                recordChunk(static_cast<uint32_t>(chunk));
+            }
+        });
+
+        // Executed in chunk order, so the draw order matches serial recording
+        secondaryCommandBuffers.clear();
+        for (const auto& chunk : recordingChunks) {
+            secondaryCommandBuffers.push_back(chunk.commandBuffer);
+        }
+        auroraRenderer.executeSecondaryCommandBuffers(commandBuffer, secondaryCommandBuffers);
+
+        profiler.incrementCounter("Secondary Command Buffers", secondaryCommandBuffers.size());
+    }
+
+    void AuroraRenderSystemManager::cullRenderSystems(const AuroraCamera& camera) {
+        const glm::vec4 view = camera.getViewBounds() + glm::vec4(-CULL_MARGIN, -CULL_MARGIN, CULL_MARGIN, CULL_MARGIN);
+        const uint64_t version = sceneStore.getSpatialIndex().getVersion();
+        if (!cullDirty && view == cullBounds && version == cullVersion) {
+            return;
+        }
+        AURORA_PROFILE("Cull Components");
+
+        visibleComponents.clear();
+        sceneStore.queryRect(view, visibleComponents);
 
         for (const auto& renderSystem : renderSystems) {
-            if (renderSystem->getComponentCount() > 0) {
-                if (renderSystem->isTransparent()) {
-                    transparentSystems.push_back(renderSystem.get());
-                } else {
-                    opaqueSystems.push_back(renderSystem.get());
-                }
+            renderSystem->beginVisibilityUpdate();
+        }
+        for (auto* component : visibleComponents) {
+            if (component->renderSystem) {
+                component->renderSystem->addVisibleComponent(component);
             }
         }
+        for (const auto& renderSystem : renderSystems) {
+            renderSystem->endVisibilityUpdate();
+        }
+
+        cullBounds = view;
+        cullVersion = version;
+        cullDirty = false;
+    }
+
+    void AuroraRenderSystemManager::buildRecordingChunks() {
+        size_t totalComponents = 0;
+        for (auto renderSystem : orderedSystems) {
+            totalComponents += renderSystem->getComponentCount();
+        }
+
+        size_t chunkCount = 1;
+        if (totalComponents >= PARALLEL_RECORDING_THRESHOLD) {
+            chunkCount = std::min<size_t>(auroraRenderer.getRecordingThreadCount(), orderedSystems.size());
+        }
 
-        for (auto renderSystem : opaqueSystems) {
-            renderSystem->renderComponents(commandBuffer, camera, auroraRenderer.getFrameIndex());
+        // Contiguous runs balanced by component count, the last chunk takes whatever is left
+        size_t targetComponents = (totalComponents + chunkCount - 1) / chunkCount;
+        recordingChunks.clear();
+
+        size_t begin = 0;
+        size_t chunkComponents = 0;
+        for (size_t i = 0; i < orderedSystems.size(); ++i) {
+            chunkComponents += orderedSystems[i]->getComponentCount();
+
+            size_t remainingSystems = orderedSystems.size() - i - 1;
+            size_t remainingChunks = chunkCount - recordingChunks.size() - 1;
+            bool full = chunkComponents >= targetComponents || remainingSystems == remainingChunks;
+            if ((full && remainingChunks > 0) || remainingSystems == 0) {
+                recordingChunks.push_back({begin, i + 1, VK_NULL_HANDLE});
+                begin = i + 1;
+                chunkComponents = 0;
+            }
         }
+    }
+
+    void AuroraRenderSystemManager::recordChunk(uint32_t chunkIndex) {
+        auto& chunk = recordingChunks[chunkIndex];
+        auto& gpuProfiler = auroraRenderer.getGpuProfiler();
 
-        for (auto renderSystem : transparentSystems) {
-            renderSystem->renderComponents(commandBuffer, camera, auroraRenderer.getFrameIndex());
+        VkCommandBuffer commandBuffer = auroraRenderer.beginSecondaryCommandBuffer(chunkIndex);
+        for (size_t i = chunk.begin; i < chunk.end; ++i) {
+            AuroraRenderSystem* renderSystem = orderedSystems[i];
+            AuroraGpuProfiler::Zone gpuZone{gpuProfiler, commandBuffer, renderSystem->getGpuZoneName()};
+            renderSystem->renderComponents(commandBuffer, *recordingCamera, recordingFrameIndex);
         }
+        auroraRenderer.endSecondaryCommandBuffer(commandBuffer);
+
+        chunk.commandBuffer = commandBuffer;
     }
 
     size_t AuroraRenderSystemManager::getTotalComponentCount() const {
@@ -99,24 +316,24 @@ namespace aurora {
     }
 
     AuroraRenderSystem* AuroraRenderSystemManager::findCompatibleRenderSystem(const AuroraComponentInterface& component) {
-        for (const auto& renderSystem : renderSystems) {
-            if (renderSystem->isCompatibleWith(component)) {
-                return renderSystem.get();
-            }
+        const PipelineDescriptor& pipeline = component.getPipeline();
+        auto it = renderSystemsByKey.find(pipeline.getKey());
+        if (it == renderSystemsByKey.end()) {
+            return nullptr;
         }
-        return nullptr;
+
+        assert(it->second->getPipeline() == pipeline && "Pipeline key collision");
+        return it->second;
     }
 
-    std::unique_ptr<AuroraRenderSystem> AuroraRenderSystemManager::createRenderSystem(const AuroraComponentInterface& component) {
+    std::unique_ptr<AuroraRenderSystem> AuroraRenderSystemManager::createRenderSystem(const PipelineDescriptor& pipeline) {
+        AURORA_PROFILE("Create Render System");
+
         RenderSystemCreateInfo createInfo{
             auroraRenderer.getSwapChainRenderPass(),
-            component.getVertexShaderPath(),
-            component.getFragmentShaderPath(),
-            component.getTopology(),
+            pipeline,
             globalDescriptorPool.get(),
-            msdfAtlas.get(),
-            component.needsTextureBinding(),
-            component.isTransparent()
+            msdfAtlas.get()
         };
 
         return std::make_unique<AuroraRenderSystem>(auroraDevice, createInfo);
@@ -0,0 +1,423 @@
+#include "aurora_ui/graphics/aurora_scene_store.hpp"
+#include "aurora_ui/components/aurora_component_interface.hpp"
+#include "aurora_engine/core/aurora_job_system.hpp"
+#include "aurora_engine/profiling/aurora_profiler.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace aurora {
+    namespace {
+        constexpr uint32_t NO_PARENT = UINT32_MAX;
+
+        template <typename T>
+        void permute(std::vector<T>& values, const std::vector<uint32_t>& order) {
+            std::vector<T> sorted;
+            sorted.reserve(order.size());
+            for (uint32_t index : order) {
+                sorted.push_back(std::move(values[index]));
+            }
+            values.swap(sorted);
+        }
+
+        // Axis-aligned bounds of a local rect under a 2D affine world transform
+        glm::vec4 transformBounds(const glm::mat4& world, const glm::vec4& bounds) {
+            glm::vec2 center = (glm::vec2(bounds.x, bounds.y) + glm::vec2(bounds.z, bounds.w)) * 0.5f;
+            glm::vec2 halfExtent = (glm::vec2(bounds.z, bounds.w) - glm::vec2(bounds.x, bounds.y)) * 0.5f;
+
+            glm::vec2 axisX{world[0][0], world[0][1]};
+            glm::vec2 axisY{world[1][0], world[1][1]};
+            glm::vec2 worldCenter = glm::vec2(world[3][0], world[3][1]) + axisX * center.x + axisY * center.y;
+            glm::vec2 worldHalfExtent = glm::abs(axisX) * halfExtent.x + glm::abs(axisY) * halfExtent.y;
+
+            return {worldCenter - worldHalfExtent, worldCenter + worldHalfExtent};
+        }
+    }
+
+    AuroraSceneStore::NodeId AuroraSceneStore::createNode(AuroraComponentInterface* owner) {
+        NodeId node;
+        if (!freeIds.empty()) {
+            node = freeIds.back();
+            freeIds.pop_back();
+        } else {
+            node = static_cast<NodeId>(denseIndices.size());
+            denseIndices.push_back(0);
+            parentIds.push_back(INVALID_NODE);
+        }
+
+        // A new root at the end keeps the depth-first order valid without a reorder
+        uint32_t index = static_cast<uint32_t>(owners.size());
+        denseIndices[node] = index;
+        parentIds[node] = INVALID_NODE;
+
+        localTransforms.emplace_back();
+        worldTransforms.emplace_back(1.0f);
+        localBounds.emplace_back(0.0f);
+        worldBounds.emplace_back(0.0f);
+        colors.emplace_back(1.0f);
+        flags.push_back(0);
+        parents.push_back(NO_PARENT);
+        roots.push_back(index);
+        subtreeEnds.push_back(index + 1);
+        nodeIds.push_back(node);
+        owners.push_back(owner);
+
+        spatialIndex.insertUnbounded(node);
+        return node;
+    }
+
+    void AuroraSceneStore::destroyNode(NodeId node) {
+        uint32_t index = denseIndices[node];
+        assert(!(flags[index] & FLAG_FREE) && "Scene node destroyed twice");
+
+        // The slot is compacted away, and the id recycled, by the next reorder
+        flags[index] = FLAG_FREE;
+        owners[index] = nullptr;
+        freedNodes.push_back(node);
+        spatialIndex.remove(node);
+        hierarchyDirty = true;
+    }
+
+    void AuroraSceneStore::setParent(NodeId node, NodeId parent) {
+        if (parentIds[node] == parent) return;
+
+        parentIds[node] = parent;
+        hierarchyDirty = true;
+        markTransformDirty(denseIndices[node]);
+    }
+
+    void AuroraSceneStore::setLocalTransform(NodeId node, const TransformComponent& transform) {
+        uint32_t index = denseIndices[node];
+        localTransforms[index] = transform;
+        markTransformDirty(index);
+    }
+
+    void AuroraSceneStore::setHidden(NodeId node, bool hidden) {
+        uint8_t& nodeFlags = flags[denseIndices[node]];
+        nodeFlags = hidden ? (nodeFlags | FLAG_HIDDEN) : (nodeFlags & ~FLAG_HIDDEN);
+    }
+
+    void AuroraSceneStore::setLocalBounds(NodeId node, glm::vec2 min, glm::vec2 max) {
+        uint32_t index = denseIndices[node];
+        glm::vec4 bounds{min, max};
+        if ((flags[index] & FLAG_BOUNDED) && localBounds[index] == bounds) return;
+
+        // The next sweep derives the world bounds and indexes them
+        localBounds[index] = bounds;
+        flags[index] |= FLAG_BOUNDED;
+        markTransformDirty(index);
+    }
+
+    void AuroraSceneStore::clearLocalBounds(NodeId node) {
+        flags[denseIndices[node]] &= ~FLAG_BOUNDED;
+        spatialIndex.insertUnbounded(node);
+    }
+
+    void AuroraSceneStore::queryRect(const glm::vec4& rect, std::vector<AuroraComponentInterface*>& out) {
+        updateTransforms();
+
+        queryResults.clear();
+        spatialIndex.queryRect(rect, queryResults);
+        for (NodeId node : queryResults) {
+            if (auto* owner = owners[denseIndices[node]]) {
+                out.push_back(owner);
+            }
+        }
+    }
+
+    void AuroraSceneStore::queryRendered(const glm::vec4& rect, std::vector<AuroraComponentInterface*>& out) {
+        updateTransforms();
+
+        queryResults.clear();
+        spatialIndex.queryRect(rect, queryResults);
+        for (NodeId node : queryResults) {
+            uint32_t index = denseIndices[node];
+            if (isPickable(index)) {
+                out.push_back(owners[index]);
+            }
+        }
+    }
+
+    AuroraComponentInterface* AuroraSceneStore::pick(glm::vec2 point) {
+        updateTransforms();
+
+        queryResults.clear();
+        spatialIndex.queryPoint(point, queryResults);
+
+        // Later components get smaller depths and are drawn on top
+        AuroraComponentInterface* picked = nullptr;
+        float pickedDepth = 0.0f;
+        for (NodeId node : queryResults) {
+            uint32_t index = denseIndices[node];
+            if (!isPickable(index)) continue;
+
+            float depth = worldTransforms[index][3][2];
+            if (!picked || depth < pickedDepth) {
+                picked = owners[index];
+                pickedDepth = depth;
+            }
+        }
+        return picked;
+    }
+
+    bool AuroraSceneStore::isPickable(uint32_t index) const {
+        // Detached components keep their node while a caller holds them, but have no render system
+        const auto* owner = owners[index];
+        return !(flags[index] & FLAG_HIDDEN) && owner && owner->renderSystem;
+    }
+
+    void AuroraSceneStore::markTransformDirty(uint32_t index) {
+        flags[index] |= FLAG_DIRTY;
+
+        // A pending reorder requeues every dirty node's root itself
+        if (hierarchyDirty) return;
+
+        uint32_t root = roots[index];
+        if (!(flags[root] & FLAG_PENDING)) {
+            flags[root] |= FLAG_PENDING;
+            pendingRoots.push_back(root);
+        }
+    }
+
+    const glm::mat4& AuroraSceneStore::getWorldTransform(NodeId node) {
+        if (hasPendingTransforms()) {
+            if (hierarchyDirty) {
+                reorder();
+            }
+
+            uint32_t root = roots[denseIndices[node]];
+            if (flags[root] & FLAG_PENDING) {
+                flags[root] &= ~FLAG_PENDING;
+                changedNodes.clear();
+                sweep(root, subtreeEnds[root], changedNodes);
+                notifyChanged(changedNodes);
+            }
+        }
+        return worldTransforms[denseIndices[node]];
+    }
+
+    void AuroraSceneStore::updateTransforms() {
+        if (!hasPendingTransforms()) return;
+        AURORA_PROFILE("Update Transforms");
+
+        if (hierarchyDirty) {
+            reorder();
+        }
+
+        // Roots resolved on demand since they were queued are no longer flagged
+        size_t sweepNodes = 0;
+        size_t rootCount = 0;
+        for (uint32_t root : pendingRoots) {
+            if (!(flags[root] & FLAG_PENDING)) continue;
+
+            flags[root] &= ~FLAG_PENDING;
+            pendingRoots[rootCount++] = root;
+            sweepNodes += subtreeEnds[root] - root;
+        }
+        pendingRoots.resize(rootCount);
+
+        size_t chunkCount = 1;
+        if (sweepNodes >= PARALLEL_SWEEP_THRESHOLD) {
+            chunkCount = std::min<size_t>(AuroraJobSystem::instance().getThreadCount(), rootCount);
+        }
+
+        uint64_t changedCount = 0;
+        if (chunkCount <= 1) {
+            changedNodes.clear();
+            for (uint32_t root : pendingRoots) {
+                sweep(root, subtreeEnds[root], changedNodes);
+            }
+            notifyChanged(changedNodes);
+            changedCount = changedNodes.size();
+        } else {
+            // Contiguous runs of roots balanced by node count
+            size_t targetNodes = (sweepNodes + chunkCount - 1) / chunkCount;
+            sweepChunks.resize(chunkCount);
+
+            size_t chunk = 0;
+            size_t chunkNodes = 0;
+            sweepChunks[0].beginRoot = 0;
+            for (size_t i = 0; i < rootCount; ++i) {
+                chunkNodes += subtreeEnds[pendingRoots[i]] - pendingRoots[i];
+                if (chunkNodes >= targetNodes && chunk + 1 < chunkCount && i + 1 < rootCount) {
+                    sweepChunks[chunk].endRoot = i + 1;
+                    sweepChunks[++chunk].beginRoot = i + 1;
+                    chunkNodes = 0;
+                }
+            }
+            sweepChunks[chunk].endRoot = rootCount;
+            sweepChunks.resize(chunk + 1);
+
+            // Subtrees of different roots never read each other
+            AuroraJobSystem::instance().parallelFor("Sweep Transforms", sweepChunks.size(), 1, [this](size_t begin, size_t end) {
+                for (size_t c = begin; c < end; ++c) {
+                    SweepChunk& sweepChunk = sweepChunks[c];
+                    sweepChunk.changed.clear();
+                    for (size_t i = sweepChunk.beginRoot; i < sweepChunk.endRoot; ++i) {
+                        uint32_t root = pendingRoots[i];
+                        sweep(root, subtreeEnds[root], sweepChunk.changed);
+                    }
+                }
+            });
+
+            // The spatial index and the owners' render systems are only touched by the calling thread
+            for (const auto& sweepChunk : sweepChunks) {
+                notifyChanged(sweepChunk.changed);
+                changedCount += sweepChunk.changed.size();
+            }
+        }
+        pendingRoots.clear();
+
+        AuroraProfiler::instance().incrementCounter("Transforms Updated", changedCount);
+    }
+
+    void AuroraSceneStore::sweep(uint32_t begin, uint32_t end, std::vector<uint32_t>& changed) {
+        for (uint32_t i = begin; i < end; ++i) {
+            uint8_t nodeFlags = flags[i];
+            uint32_t parent = parents[i];
+
+            // Parents precede children, so a parent's flag is already up to date for this sweep
+            bool recompute = (nodeFlags & FLAG_DIRTY) || (parent != NO_PARENT && (flags[parent] & FLAG_CHANGED));
+            if (!recompute) {
+                flags[i] = nodeFlags & ~FLAG_CHANGED;
+                continue;
+            }
+
+            glm::mat4 localTransform = localTransforms[i].mat4();
+            if (parent != NO_PARENT) {
+                float ourZDepth = localTransform[3][2];
+                worldTransforms[i] = worldTransforms[parent] * localTransform;
+                worldTransforms[i][3][2] = ourZDepth;
+            } else {
+                worldTransforms[i] = localTransform;
+            }
+
+            if (nodeFlags & FLAG_BOUNDED) {
+                worldBounds[i] = transformBounds(worldTransforms[i], localBounds[i]);
+            }
+
+            flags[i] = (nodeFlags & ~FLAG_DIRTY) | FLAG_CHANGED;
+            changed.push_back(i);
+        }
+    }
+
+    void AuroraSceneStore::notifyChanged(const std::vector<uint32_t>& changed) {
+        for (uint32_t index : changed) {
+            if (flags[index] & FLAG_BOUNDED) {
+                spatialIndex.insert(nodeIds[index], worldBounds[index]);
+            }
+            if (auto* owner = owners[index]) {
+                owner->markDirty();
+            }
+        }
+    }
+
+    void AuroraSceneStore::reorder() {
+        AURORA_PROFILE("Reorder Scene");
+        const uint32_t count = static_cast<uint32_t>(owners.size());
+
+        // Dense parent of every live node; children of destroyed nodes become roots
+        std::vector<uint32_t> oldParents(count, NO_PARENT);
+        std::vector<uint32_t> childCounts(count + 1, 0);
+        for (uint32_t i = 0; i < count; ++i) {
+            if (flags[i] & FLAG_FREE) continue;
+
+            NodeId parentId = parentIds[nodeIds[i]];
+            if (parentId == INVALID_NODE) continue;
+
+            uint32_t parent = denseIndices[parentId];
+            if (flags[parent] & FLAG_FREE) {
+                parentIds[nodeIds[i]] = INVALID_NODE;
+                flags[i] |= FLAG_DIRTY;
+                continue;
+            }
+            oldParents[i] = parent;
+            ++childCounts[parent + 1];
+        }
+
+        // Children grouped per parent, in their current relative order
+        for (uint32_t i = 0; i < count; ++i) {
+            childCounts[i + 1] += childCounts[i];
+        }
+        std::vector<uint32_t> children(childCounts[count]);
+        std::vector<uint32_t> fill(childCounts.begin(), childCounts.end() - 1);
+        for (uint32_t i = 0; i < count; ++i) {
+            if (oldParents[i] != NO_PARENT) {
+                children[fill[oldParents[i]]++] = i;
+            }
+        }
+
+        // Depth-first order starting from every root
+        std::vector<uint32_t> order;
+        order.reserve(count);
+        std::vector<uint32_t> stack;
+        for (uint32_t i = 0; i < count; ++i) {
+            if ((flags[i] & FLAG_FREE) || oldParents[i] != NO_PARENT) continue;
+
+            stack.push_back(i);
+            while (!stack.empty()) {
+                uint32_t node = stack.back();
+                stack.pop_back();
+                order.push_back(node);
+
+                for (uint32_t c = childCounts[node + 1]; c > childCounts[node]; --c) {
+                    stack.push_back(children[c - 1]);
+                }
+            }
+        }
+
+        std::vector<uint32_t> newIndices(count, NO_PARENT);
+        for (uint32_t i = 0; i < order.size(); ++i) {
+            newIndices[order[i]] = i;
+        }
+
+        permute(localTransforms, order);
+        permute(worldTransforms, order);
+        permute(localBounds, order);
+        permute(worldBounds, order);
+        permute(colors, order);
+        permute(flags, order);
+        permute(nodeIds, order);
+        permute(owners, order);
+
+        const uint32_t liveCount = static_cast<uint32_t>(order.size());
+        parents.resize(liveCount);
+        roots.resize(liveCount);
+        subtreeEnds.resize(liveCount);
+        for (uint32_t i = 0; i < liveCount; ++i) {
+            uint32_t oldParent = oldParents[order[i]];
+            parents[i] = oldParent == NO_PARENT ? NO_PARENT : newIndices[oldParent];
+            roots[i] = parents[i] == NO_PARENT ? i : roots[parents[i]];
+            denseIndices[nodeIds[i]] = i;
+            subtreeEnds[i] = 1;
+        }
+
+        // Subtree sizes accumulate bottom-up, children always sit after their parent
+        for (uint32_t i = liveCount; i-- > 0;) {
+            if (parents[i] != NO_PARENT) {
+                subtreeEnds[parents[i]] += subtreeEnds[i];
+            }
+        }
+        for (uint32_t i = 0; i < liveCount; ++i) {
+            subtreeEnds[i] += i;
+        }
+
+        freeIds.insert(freeIds.end(), freedNodes.begin(), freedNodes.end());
+        freedNodes.clear();
+        hierarchyDirty = false;
+
+        pendingRoots.clear();
+        for (uint32_t i = 0; i < liveCount; ++i) {
+            flags[i] &= ~FLAG_PENDING;
+        }
+        for (uint32_t i = 0; i < liveCount; ++i) {
+            if (!(flags[i] & FLAG_DIRTY)) continue;
+
+            uint32_t root = roots[i];
+            if (!(flags[root] & FLAG_PENDING)) {
+                flags[root] |= FLAG_PENDING;
+                pendingRoots.push_back(root);
+            }
+        }
+    }
+}
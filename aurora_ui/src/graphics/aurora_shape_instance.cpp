@@ -0,0 +1,53 @@
+#include "aurora_ui/graphics/aurora_shape_instance.hpp"
+#include "aurora_ui/graphics/aurora_glyph_instance.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace aurora {
+    ShapeInstance ShapeInstance::fromWorldTransform(const glm::mat4& world, glm::vec2 offset, glm::vec2 size,
+                                                    float cornerRadius, float borderWidth, float shadowBlur) {
+        const glm::vec2 origin{world[3][0], world[3][1]};
+        const glm::vec2 scale{glm::length(glm::vec2(world[0])), glm::length(glm::vec2(world[1]))};
+        const float uniformScale = std::min(scale.x, scale.y);
+
+        ShapeInstance instance{};
+        instance.position = origin + offset * scale;
+        instance.size = size * scale;
+        instance.cornerRadii = glm::vec4(cornerRadius * uniformScale);
+        instance.borderWidth = borderWidth * uniformScale;
+        instance.shadowBlur = shadowBlur * uniformScale;
+        instance.depth = world[3][2];
+        return instance;
+    }
+
+    uint32_t ShapeInstance::packColor(const glm::vec4& color) {
+        return GlyphInstance::packColor(color);
+    }
+
+    std::vector<VkVertexInputBindingDescription> ShapeInstance::getBindingDescriptions() {
+        std::vector<VkVertexInputBindingDescription> bindingDescriptions(1);
+
+        bindingDescriptions[0].binding = 0;
+        bindingDescriptions[0].stride = sizeof(ShapeInstance);
+        bindingDescriptions[0].inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+
+        return bindingDescriptions;
+    }
+
+    std::vector<VkVertexInputAttributeDescription> ShapeInstance::getAttributeDescriptions() {
+        std::vector<VkVertexInputAttributeDescription> attributeDescriptions{};
+
+        attributeDescriptions.push_back({0, 0, VK_FORMAT_R32G32_SFLOAT, offsetof(ShapeInstance, position)});
+        attributeDescriptions.push_back({1, 0, VK_FORMAT_R32G32_SFLOAT, offsetof(ShapeInstance, size)});
+        attributeDescriptions.push_back({2, 0, VK_FORMAT_R32G32B32A32_SFLOAT, offsetof(ShapeInstance, cornerRadii)});
+        attributeDescriptions.push_back({3, 0, VK_FORMAT_R32_SFLOAT, offsetof(ShapeInstance, borderWidth)});
+        attributeDescriptions.push_back({4, 0, VK_FORMAT_R32_SFLOAT, offsetof(ShapeInstance, shadowBlur)});
+        attributeDescriptions.push_back({5, 0, VK_FORMAT_R32_SFLOAT, offsetof(ShapeInstance, depth)});
+        attributeDescriptions.push_back({6, 0, VK_FORMAT_R8G8B8A8_UNORM, offsetof(ShapeInstance, fillColor)});
+        attributeDescriptions.push_back({7, 0, VK_FORMAT_R8G8B8A8_UNORM, offsetof(ShapeInstance, borderColor)});
+        attributeDescriptions.push_back({8, 0, VK_FORMAT_R8G8B8A8_UNORM, offsetof(ShapeInstance, shadowColor)});
+
+        return attributeDescriptions;
+    }
+}
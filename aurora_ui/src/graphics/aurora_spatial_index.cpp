@@ -0,0 +1,236 @@
+#include "aurora_ui/graphics/aurora_spatial_index.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace aurora {
+    namespace {
+        bool overlaps(const glm::vec4& a, const glm::vec4& b) {
+            return a.x <= b.z && b.x <= a.z && a.y <= b.w && b.y <= a.w;
+        }
+
+        bool containsPoint(const glm::vec4& bounds, glm::vec2 point) {
+            return point.x >= bounds.x && point.x <= bounds.z && point.y >= bounds.y && point.y <= bounds.w;
+        }
+
+        // Clamped so far-away or infinite coordinates still land in a representable cell
+        int32_t toCell(float coordinate, float inverseCellSize) {
+            float cell = std::floor(coordinate * inverseCellSize);
+            return static_cast<int32_t>(std::clamp(cell, -1073741824.0f, 1073741824.0f));
+        }
+    }
+
+    AuroraSpatialIndex::AuroraSpatialIndex(float cellSize)
+        : cellSize{cellSize}, inverseCellSize{1.0f / cellSize} {
+        assert(cellSize > 0.0f && "Cell size must be positive");
+    }
+
+    AuroraSpatialIndex::CellRange AuroraSpatialIndex::getCellRange(const glm::vec4& bounds) const {
+        return {
+            toCell(bounds.x, inverseCellSize),
+            toCell(bounds.y, inverseCellSize),
+            toCell(bounds.z, inverseCellSize),
+            toCell(bounds.w, inverseCellSize),
+        };
+    }
+
+    uint64_t AuroraSpatialIndex::cellKey(int32_t x, int32_t y) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+    }
+
+    void AuroraSpatialIndex::insert(ItemId item, const glm::vec4& bounds) {
+        if (item >= items.size()) {
+            items.resize(item + 1);
+        }
+        Item& entry = items[item];
+        CellRange range = getCellRange(bounds);
+
+        // Moving within the same cells only updates the bounds
+        if (entry.placement == PLACEMENT_CELLS && entry.cells == range) {
+            if (entry.bounds != bounds) {
+                entry.bounds = bounds;
+                ++version;
+            }
+            return;
+        }
+
+        if (entry.placement != PLACEMENT_NONE) {
+            unlink(item);
+        } else {
+            ++itemCount;
+        }
+
+        entry.bounds = bounds;
+        entry.cells = range;
+
+        int64_t span = (static_cast<int64_t>(range.maxX) - range.minX + 1) * (static_cast<int64_t>(range.maxY) - range.minY + 1);
+        entry.placement = span > MAX_CELL_SPAN ? PLACEMENT_LARGE : PLACEMENT_CELLS;
+        link(item);
+        ++version;
+    }
+
+    void AuroraSpatialIndex::insertUnbounded(ItemId item) {
+        if (item >= items.size()) {
+            items.resize(item + 1);
+        }
+        Item& entry = items[item];
+        if (entry.placement == PLACEMENT_UNBOUNDED) return;
+
+        if (entry.placement != PLACEMENT_NONE) {
+            unlink(item);
+        } else {
+            ++itemCount;
+        }
+
+        entry.placement = PLACEMENT_UNBOUNDED;
+        link(item);
+        ++version;
+    }
+
+    void AuroraSpatialIndex::remove(ItemId item) {
+        if (!contains(item)) return;
+
+        unlink(item);
+        items[item].placement = PLACEMENT_NONE;
+        --itemCount;
+        ++version;
+    }
+
+    void AuroraSpatialIndex::link(ItemId item) {
+        Item& entry = items[item];
+        switch (entry.placement) {
+            case PLACEMENT_CELLS: {
+                // Keeps its capacity, an item moving between cells does not reallocate
+                entry.cellSlots.clear();
+                uint32_t rangeIndex = 0;
+                for (int32_t y = entry.cells.minY; y <= entry.cells.maxY; ++y) {
+                    for (int32_t x = entry.cells.minX; x <= entry.cells.maxX; ++x) {
+                        auto& cellItems = cells[cellKey(x, y)];
+                        entry.cellSlots.push_back(static_cast<uint32_t>(cellItems.size()));
+                        cellItems.push_back({item, rangeIndex++});
+                    }
+                }
+                break;
+            }
+            case PLACEMENT_LARGE:
+                addToList(largeItems, item);
+                break;
+            case PLACEMENT_UNBOUNDED:
+                addToList(unboundedItems, item);
+                break;
+            case PLACEMENT_NONE:
+                break;
+        }
+    }
+
+    void AuroraSpatialIndex::unlink(ItemId item) {
+        Item& entry = items[item];
+        switch (entry.placement) {
+            case PLACEMENT_CELLS: {
+                uint32_t rangeIndex = 0;
+                for (int32_t y = entry.cells.minY; y <= entry.cells.maxY; ++y) {
+                    for (int32_t x = entry.cells.minX; x <= entry.cells.maxX; ++x) {
+                        auto cell = cells.find(cellKey(x, y));
+                        assert(cell != cells.end() && "Item missing from its cell");
+
+                        // Order within a cell does not matter, the last entry fills the gap
+                        auto& cellItems = cell->second;
+                        uint32_t slot = entry.cellSlots[rangeIndex++];
+                        assert(cellItems[slot].item == item && "Stale cell slot");
+                        cellItems[slot] = cellItems.back();
+                        items[cellItems[slot].item].cellSlots[cellItems[slot].rangeIndex] = slot;
+                        cellItems.pop_back();
+                        if (cellItems.empty()) {
+                            cells.erase(cell);
+                        }
+                    }
+                }
+                break;
+            }
+            case PLACEMENT_LARGE:
+                removeFromList(largeItems, item);
+                break;
+            case PLACEMENT_UNBOUNDED:
+                removeFromList(unboundedItems, item);
+                break;
+            case PLACEMENT_NONE:
+                break;
+        }
+    }
+
+    void AuroraSpatialIndex::addToList(std::vector<ItemId>& list, ItemId item) {
+        items[item].listSlot = static_cast<uint32_t>(list.size());
+        list.push_back(item);
+    }
+
+    void AuroraSpatialIndex::removeFromList(std::vector<ItemId>& list, ItemId item) {
+        uint32_t slot = items[item].listSlot;
+        list[slot] = list.back();
+        items[list[slot]].listSlot = slot;
+        list.pop_back();
+    }
+
+    void AuroraSpatialIndex::queryRect(const glm::vec4& rect, std::vector<ItemId>& out) const {
+        CellRange range = getCellRange(rect);
+
+        // Walk whichever is smaller, the covered cells or the occupied ones
+        int64_t coveredCells = (static_cast<int64_t>(range.maxX) - range.minX + 1) * (static_cast<int64_t>(range.maxY) - range.minY + 1);
+        auto visitCell = [&](int32_t x, int32_t y, const std::vector<CellEntry>& cellItems) {
+            for (const CellEntry& cellEntry : cellItems) {
+                ItemId item = cellEntry.item;
+                const Item& entry = items[item];
+                // An item spanning several queried cells is reported by the first of them only
+                if (x != std::max(entry.cells.minX, range.minX) || y != std::max(entry.cells.minY, range.minY)) continue;
+                if (overlaps(entry.bounds, rect)) {
+                    out.push_back(item);
+                }
+            }
+        };
+
+        if (coveredCells <= static_cast<int64_t>(cells.size())) {
+            for (int32_t y = range.minY; y <= range.maxY; ++y) {
+                for (int32_t x = range.minX; x <= range.maxX; ++x) {
+                    auto cell = cells.find(cellKey(x, y));
+                    if (cell != cells.end()) {
+                        visitCell(x, y, cell->second);
+                    }
+                }
+            }
+        } else {
+            for (const auto& [key, cellItems] : cells) {
+                int32_t x = static_cast<int32_t>(static_cast<uint32_t>(key >> 32));
+                int32_t y = static_cast<int32_t>(static_cast<uint32_t>(key));
+                if (x >= range.minX && x <= range.maxX && y >= range.minY && y <= range.maxY) {
+                    visitCell(x, y, cellItems);
+                }
+            }
+        }
+
+        for (ItemId item : largeItems) {
+            if (overlaps(items[item].bounds, rect)) {
+                out.push_back(item);
+            }
+        }
+        out.insert(out.end(), unboundedItems.begin(), unboundedItems.end());
+    }
+
+    void AuroraSpatialIndex::queryPoint(glm::vec2 point, std::vector<ItemId>& out) const {
+        int32_t x = toCell(point.x, inverseCellSize);
+        int32_t y = toCell(point.y, inverseCellSize);
+
+        auto cell = cells.find(cellKey(x, y));
+        if (cell != cells.end()) {
+            for (const CellEntry& cellEntry : cell->second) {
+                if (containsPoint(items[cellEntry.item].bounds, point)) {
+                    out.push_back(cellEntry.item);
+                }
+            }
+        }
+        for (ItemId item : largeItems) {
+            if (containsPoint(items[item].bounds, point)) {
+                out.push_back(item);
+            }
+        }
+    }
+}
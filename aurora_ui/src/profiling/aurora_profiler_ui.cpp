@@ -1,6 +1,7 @@
 #include "aurora_ui/profiling/aurora_profiler_ui.hpp"
 #include "aurora_ui/components/aurora_text.hpp"
 #include "aurora_ui/utils/aurora_theme_settings.hpp"
+#include "aurora_engine/profiling/aurora_gpu_profiler.hpp"
 #include <cstdio>
 #include <spdlog/spdlog.h>
 
@@ -12,7 +13,7 @@ namespace aurora {
         
         auto title = std::make_shared<AuroraText>(componentInfo, "[PROFILER]", 16.0f);
         title->setPosition(50.0f, 30.0f);
-        title->color = AuroraThemeSettings::get().TEXT_SECONDARY;
+        title->setColor(AuroraThemeSettings::get().TEXT_SECONDARY);
         title->addToRenderSystem();
         displayElements_.push_back(title);
         
@@ -21,7 +22,7 @@ namespace aurora {
         float yOffset = 40.0f + (currentLine_ * lineHeight_);
         fpsText_ = std::make_shared<AuroraText>(componentInfo, "FPS: 0.0 | Frame Time: 0.00ms", 16.0f);
         fpsText_->setPosition(50.0f, yOffset);
-        fpsText_->color = AuroraThemeSettings::get().TEXT_PRIMARY;
+        fpsText_->setColor(AuroraThemeSettings::get().TEXT_PRIMARY);
         fpsText_->addToRenderSystem();
         displayElements_.push_back(fpsText_);
         
@@ -35,7 +36,7 @@ namespace aurora {
         
         auto funcText = std::make_shared<AuroraText>(componentInfo, functionName, 16.0f);
         funcText->setPosition(50.0f, yOffset);
-        funcText->color = AuroraThemeSettings::get().TEXT_PRIMARY;
+        funcText->setColor(AuroraThemeSettings::get().TEXT_PRIMARY);
         funcText->addToRenderSystem();
         displayElements_.push_back(funcText);
         
@@ -43,13 +44,13 @@ namespace aurora {
         
         auto avgText = std::make_shared<AuroraText>(componentInfo, "  Avg: 0.00ms", 16.0f);
         avgText->setPosition(70.0f, yOffset + 30.0f);
-        avgText->color = AuroraThemeSettings::get().TEXT_PRIMARY;
+        avgText->setColor(AuroraThemeSettings::get().TEXT_PRIMARY);
         avgText->addToRenderSystem();
         displayElements_.push_back(avgText);
         
         auto minMaxText = std::make_shared<AuroraText>(componentInfo, "  Min: 0.00ms Max: 0.00ms", 16.0f);
         minMaxText->setPosition(70.0f, yOffset + 60.0f);
-        minMaxText->color = AuroraThemeSettings::get().TEXT_PRIMARY;
+        minMaxText->setColor(AuroraThemeSettings::get().TEXT_PRIMARY);
         minMaxText->addToRenderSystem();
         displayElements_.push_back(minMaxText);
         
@@ -63,7 +64,7 @@ namespace aurora {
         
         auto counterText = std::make_shared<AuroraText>(componentInfo, counterName, 16.0f);
         counterText->setPosition(50.0f, yOffset);
-        counterText->color = AuroraThemeSettings::get().TEXT_PRIMARY;
+        counterText->setColor(AuroraThemeSettings::get().TEXT_PRIMARY);
         counterText->addToRenderSystem();
         displayElements_.push_back(counterText);
         
@@ -85,6 +86,9 @@ namespace aurora {
             formatTime(frameTime, formatBuffer_.data(), formatBuffer_.size());
             std::string combinedStr = "FPS: " + std::to_string(static_cast<int>(fps + 0.5)) + 
                                     " | Frame Time: " + std::string(formatBuffer_.data()) + "ms";
+
+            formatTime(profiler_.getStats(AuroraGpuProfiler::RENDER_PASS_ZONE).current, formatBuffer_.data(), formatBuffer_.size());
+            combinedStr += " | GPU: " + std::string(formatBuffer_.data()) + "ms";
             fpsText_->setText(combinedStr);
         }
         
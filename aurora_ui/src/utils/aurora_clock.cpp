@@ -1,5 +1,6 @@
 #include "aurora_ui/utils/aurora_clock.hpp"
 #include "aurora_engine/profiling/aurora_profiler.hpp"
+#include "aurora_engine/profiling/aurora_gpu_profiler.hpp"
 #include "aurora_engine/utils/log.hpp"
 #include <thread>
 #include <iomanip>
@@ -74,7 +75,7 @@ namespace aurora {
         
         csvFile_.open(filename);
         if (csvFile_.is_open()) {
-            csvFile_ << "timestamp_ms,frame_time_ms,fps,render_components_ms,poll_events_ms,begin_frame_ms,end_frame_ms,profiler_ui_ms\n";
+            csvFile_ << "timestamp_ms,frame_time_ms,fps,render_components_ms,poll_events_ms,begin_frame_ms,end_frame_ms,profiler_ui_ms,gpu_render_pass_ms\n";
             csvFile_ << std::fixed << std::setprecision(3);
             csvLoggingEnabled_ = true;
             log::ui()->info("CSV logging enabled, writing to: {}", filename);
@@ -100,8 +101,9 @@ namespace aurora {
             double beginTime = profiler.getStats("Begin Frame").current;
             double endTime = profiler.getStats("End Frame").current;
             double uiTime = profiler.getStats("Profiler UI Update").current;
+            double gpuTime = profiler.getStats(AuroraGpuProfiler::RENDER_PASS_ZONE).current;
             
-            csvFile_ << timestampMs_ << "," << frameTimeMs_ << "," << fps_ << "," << renderTime << "," << pollTime << "," << beginTime << "," << endTime << "," << uiTime << "\n";
+            csvFile_ << timestampMs_ << "," << frameTimeMs_ << "," << fps_ << "," << renderTime << "," << pollTime << "," << beginTime << "," << endTime << "," << uiTime << "," << gpuTime << "\n";
         }
     }
 
@@ -0,0 +1,81 @@
+#include "aurora_ui/utils/aurora_scrollback.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace aurora {
+    AuroraScrollback::AuroraScrollback(size_t capacity, size_t maxLineLength)
+        : lines(std::max<size_t>(1, capacity)), maxLineLength{std::max<size_t>(1, maxLineLength)} {
+        for (auto& line : lines) {
+            line.reserve(this->maxLineLength);
+        }
+    }
+
+    size_t AuroraScrollback::append(std::string_view text) {
+        // A trailing newline ends the last line rather than starting an empty one
+        if (!text.empty() && text.back() == '\n') {
+            text.remove_suffix(1);
+        }
+
+        size_t appended = 0;
+        size_t start = 0;
+        while (true) {
+            size_t end = text.find('\n', start);
+            if (end == std::string_view::npos) {
+                appended += appendParagraph(text.substr(start));
+                break;
+            }
+            appended += appendParagraph(text.substr(start, end - start));
+            start = end + 1;
+        }
+        return appended;
+    }
+
+    void AuroraScrollback::clear() {
+        lineCount = 0;
+    }
+
+    size_t AuroraScrollback::appendParagraph(std::string_view text) {
+        std::string* line = &pushLine();
+        size_t appended = 1;
+
+        size_t position = 0;
+        while (position < text.size()) {
+            size_t wordStart = text.find_first_not_of(" \t\r", position);
+            if (wordStart == std::string_view::npos) break;
+            size_t wordEnd = std::min(text.find_first_of(" \t\r", wordStart), text.size());
+            std::string_view word = text.substr(wordStart, wordEnd - wordStart);
+            position = wordEnd;
+
+            if (!line->empty() && line->size() + 1 + word.size() > maxLineLength) {
+                line = &pushLine();
+                ++appended;
+            }
+            if (!line->empty()) {
+                line->push_back(' ');
+            }
+
+            // Only a word longer than a whole line gets here without fitting
+            while (word.size() > maxLineLength - line->size()) {
+                size_t fits = maxLineLength - line->size();
+                line->append(word.substr(0, fits));
+                word.remove_prefix(fits);
+                line = &pushLine();
+                ++appended;
+            }
+            line->append(word);
+        }
+
+        assert(line->size() <= maxLineLength);
+        return appended;
+    }
+
+    std::string& AuroraScrollback::pushLine() {
+        std::string& line = lines[endLine % lines.size()];
+        ++endLine;
+        lineCount = std::min(lineCount + 1, lines.size());
+
+        line.clear();
+        return line;
+    }
+}
@@ -4,11 +4,14 @@
 #include "aurora_debug/aurora_debug_server.hpp"
 
 #include "aurora_engine/utils/log.hpp"
+#include "aurora_engine/profiling/aurora_profiler.hpp"
 #include <fontconfig/fontconfig.h>
 
 class DebugApp : public aurora::AuroraUI {
     public:
-        DebugApp() : AuroraUI{"Aurora Debug"} {}
+        DebugApp() : AuroraUI{"Aurora Debug"} {
+            setRenderMode(RenderMode::OnDemand);
+        }
 
     protected:
         void onSetup(aurora::AuroraComponentInfo& info) override {
@@ -25,6 +28,8 @@ class DebugApp : public aurora::AuroraUI {
 
             panel->addToRenderSystem();
 
+            aurora::AuroraProfiler::instance().setSlowFrameCapture(100.0, "traces");
+
             server.onConnect([this](aurora::debug::AuroraDebugSession& session) {
                 connectedClients++;
                 aurora::log::debug()->info("Client connected: {}", session.getAddress());
@@ -46,6 +51,8 @@ class DebugApp : public aurora::AuroraUI {
                 last_msg_payload.setValue(msg.payload);
             });
 
+            server.onWake([] { aurora::AuroraUI::wake(); });
+
             server.start();
         }
 